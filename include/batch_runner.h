@@ -0,0 +1,452 @@
+/*
+ * batch_runner.h
+ * Runs many independent GAs (seed and parameter sweeps) in one process
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef BATCH_RUNNER_H_
+#define BATCH_RUNNER_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <algorithm>
+#include <type_traits>
+#include <cmath>
+#include <float.h>
+#include "ga_statistics.h"
+#include "util/work_stealing_pool.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * result of one run of a batch
+ */
+struct batch_run_result
+{
+	string configuration;
+	size_t run = 0;
+	uint64_t seed = 0;
+
+	double best_fitness = - DBL_MAX;
+	unsigned long long num_of_evaluations = 0;
+	long long num_of_generations = 0;
+	double elapsed_seconds = 0;
+
+	// time and evaluations to reach target fitness of configuration (if reached)
+	bool target_reached = false;
+	double time_to_target_seconds = NAN;
+	unsigned long long evaluations_to_target = 0;
+};
+
+/**
+ * summary of all runs of a configuration
+ */
+struct batch_summary
+{
+	string configuration;
+	size_t num_of_runs = 0;
+	double target_fitness = DBL_MAX;
+
+	// of best fitness of runs (quartiles are linearly interpolated)
+	double best_fitness = NAN;
+	double median_fitness = NAN;
+	double lower_quartile_fitness = NAN;
+	double upper_quartile_fitness = NAN;
+	double interquartile_range = NAN;
+
+	// over runs that reached target fitness (NAN if none reached it)
+	size_t num_of_runs_reached = 0;
+	double median_time_to_target_seconds = NAN;
+	double median_evaluations_to_target = NAN;
+};
+
+/**
+ * BATCH RUNNER (batch_runner)
+ * ===========================
+ * Runs many independent optimizers (simple_ga, nsga2_ga, differential_evolution,
+ * cma_es or derived classes) on one work stealing pool, and summarizes each
+ * configuration by best, median and interquartile range of best fitness of its runs,
+ * and by median time (and evaluations) to reach its target fitness.
+ *
+ * addRuns(configuration, num_of_runs, first_seed, target_fitness, factory) adds
+ * num_of_runs runs of optimizers made by factory (returning a new optimizer
+ * with its parameters set), with seeds first_seed, first_seed + 1, ...
+ * Display of progress of each optimizer is switched off, so only results are shown.
+ * Optimizers should use a single thread (e.g. no initialization threads),
+ * since all threads of pool are already busy.
+ *
+ * A run is done entirely by one thread, so results are same as running each
+ * optimizer alone with its seed (except for times).
+ * Time to target is time at which final best fitness was found, so it is exact
+ * when optimizers stop at target fitness (e.g. with stopOnTarget).
+ *
+ * --- EXAMPLE ---
+ * batch_runner runner(thread::hardware_concurrency());
+ * runner.addRuns("mutation 0.1", 30, 1, 0, []()
+ * {
+ *     nqueen_genetic_algo * gaP = new nqueen_genetic_algo(50);
+ *     gaP->setParameters(100, 500, 0.9, 0.1, 0.03, true);
+ *     return gaP;
+ * });
+ * runner.run();
+ * runner.writeCsv(cout);
+ *
+ */
+class batch_runner
+{
+public :
+	explicit batch_runner(unsigned num_of_threads) :
+		NUM_OF_THREADS(max(1u, num_of_threads))
+	{
+	}
+
+	/**
+	 * add runs of a configuration, factory returns a new optimizer (owned by runner)
+	 */
+	template<typename Factory>
+	void addRuns(const string & configuration, size_t num_of_runs, uint64_t first_seed,
+			double target_fitness, Factory factory)
+	{
+		typedef typename remove_pointer<decltype(factory())>::type optimizer_type;
+
+		const size_t configuration_index = addConfiguration(configuration, target_fitness);
+		for(size_t r = 0; r < num_of_runs; r++)
+		{
+			batch_run_result result;
+			result.configuration = configuration;
+			result.run = r;
+			result.seed = first_seed + r;
+			const size_t result_index = results.size();
+			results.push_back(result);
+			result_configurations.push_back(configuration_index);
+
+			jobs.push_back([this, factory, result_index, target_fitness]()
+			{
+				unique_ptr<optimizer_type> optimizerP(factory());
+				optimizerP->setVerbose(false);
+				optimizerP->setSeed(results[result_index].seed);
+				optimizerP->run();
+				noteResult(results[result_index], optimizerP->getStatistics(),
+						optimizerP->getBestFitness(), target_fitness);
+			});
+		}
+	}
+
+	/**
+	 * run all added runs (that are not run yet), and summarize all configurations
+	 */
+	void run()
+	{
+		if(next_job < jobs.size())
+		{
+			work_stealing_pool pool(NUM_OF_THREADS);
+			for(; next_job < jobs.size(); next_job++)
+			{
+				pool.execute(jobs[next_job]);
+			}
+			pool.wait();
+		}
+
+		summarize();
+	}
+
+	const vector<batch_run_result> & getResults()
+	{
+		return results;
+	}
+
+	const vector<batch_summary> & getSummaries()
+	{
+		return summaries;
+	}
+
+	/**
+	 * write summary of each configuration as CSV (with header),
+	 * and result of each run after it if per_run_results is true
+	 */
+	void writeCsv(ostream & out, bool per_run_results = false);
+
+	/**
+	 * write summaries (and results of runs) as JSON
+	 */
+	void writeJson(ostream & out);
+
+private:
+	const unsigned NUM_OF_THREADS;
+
+	vector<function<void()>> jobs;
+	size_t next_job = 0;
+
+	// results of runs are written by their jobs only (each job has its own result)
+	vector<batch_run_result> results;
+	vector<size_t> result_configurations;
+	vector<batch_summary> summaries;
+
+	size_t addConfiguration(const string & configuration, double target_fitness);
+	static void noteResult(batch_run_result & result, const ga_statistics & statistics,
+			double best_fitness, double target_fitness);
+	void summarize();
+	static double quantile(const vector<double> & sorted_values, double q);
+	static void writeJsonNumber(ostream & out, double value);
+	static void writeJsonString(ostream & out, const string & value);
+	static void writeCsvString(ostream & out, const string & value);
+};
+
+/**
+ * IMPLEMENTATION OF METHODS OF CLASS "batch_runner"
+ * =================================================
+ */
+
+/**
+ * index of summary of a configuration (added if it is new)
+ */
+inline size_t batch_runner::addConfiguration(const string & configuration, double target_fitness)
+{
+	for(size_t c = 0; c < summaries.size(); c++)
+	{
+		if(summaries[c].configuration == configuration)
+		{
+			summaries[c].target_fitness = target_fitness;
+			return c;
+		}
+	}
+
+	batch_summary summary;
+	summary.configuration = configuration;
+	summary.target_fitness = target_fitness;
+	summaries.push_back(summary);
+	return summaries.size() - 1;
+}
+
+/**
+ * note result of a finished run from its statistics
+ */
+inline void batch_runner::noteResult(batch_run_result & result, const ga_statistics & statistics,
+		double best_fitness, double target_fitness)
+{
+	result.best_fitness = best_fitness;
+	result.num_of_evaluations = statistics.num_of_evaluations;
+	result.num_of_generations = statistics.num_of_generations;
+	result.elapsed_seconds = statistics.elapsed_seconds;
+
+	result.target_reached = best_fitness >= target_fitness;
+	if(result.target_reached)
+	{
+		// best fitness was first found when it reached target (or later)
+		result.time_to_target_seconds = statistics.best_fitness_elapsed_seconds;
+		result.evaluations_to_target = statistics.best_fitness_evaluation;
+	}
+}
+
+/**
+ * find best, quartiles and time to target of each configuration
+ */
+inline void batch_runner::summarize()
+{
+	vector<double> fitness_values, times, evaluations;
+	for(size_t c = 0; c < summaries.size(); c++)
+	{
+		fitness_values.clear();
+		times.clear();
+		evaluations.clear();
+		for(size_t i = 0; i < results.size(); i++)
+		{
+			if(result_configurations[i] == c)
+			{
+				fitness_values.push_back(results[i].best_fitness);
+				if(results[i].target_reached)
+				{
+					times.push_back(results[i].time_to_target_seconds);
+					evaluations.push_back(results[i].evaluations_to_target);
+				}
+			}
+		}
+		sort(fitness_values.begin(), fitness_values.end());
+		sort(times.begin(), times.end());
+		sort(evaluations.begin(), evaluations.end());
+
+		batch_summary & summary = summaries[c];
+		summary.num_of_runs = fitness_values.size();
+		summary.num_of_runs_reached = times.size();
+		if(!fitness_values.empty())
+		{
+			summary.best_fitness = fitness_values.back();
+		}
+		summary.median_fitness = quantile(fitness_values, 0.5);
+		summary.lower_quartile_fitness = quantile(fitness_values, 0.25);
+		summary.upper_quartile_fitness = quantile(fitness_values, 0.75);
+		summary.interquartile_range =
+			summary.upper_quartile_fitness - summary.lower_quartile_fitness;
+		summary.median_time_to_target_seconds = quantile(times, 0.5);
+		summary.median_evaluations_to_target = quantile(evaluations, 0.5);
+	}
+}
+
+/**
+ * q-th quantile of sorted values, linearly interpolated (NAN if there is no value)
+ */
+inline double batch_runner::quantile(const vector<double> & sorted_values, double q)
+{
+	if(sorted_values.empty())
+	{
+		return NAN;
+	}
+
+	const double position = q*(sorted_values.size() - 1);
+	const size_t lower = (size_t) position;
+	const size_t upper = min(lower + 1, sorted_values.size() - 1);
+	return sorted_values[lower] + (position - lower)*(sorted_values[upper] - sorted_values[lower]);
+}
+
+inline void batch_runner::writeCsv(ostream & out, bool per_run_results)
+{
+	out<<"configuration,runs,target_fitness,best_fitness,median_fitness,"
+			<<"lower_quartile_fitness,upper_quartile_fitness,interquartile_range,"
+			<<"runs_reached_target,median_time_to_target_seconds,median_evaluations_to_target"
+			<<endl;
+	for(const batch_summary & summary : summaries)
+	{
+		writeCsvString(out, summary.configuration);
+		out<<","<<summary.num_of_runs<<","<<summary.target_fitness
+				<<","<<summary.best_fitness<<","<<summary.median_fitness
+				<<","<<summary.lower_quartile_fitness<<","<<summary.upper_quartile_fitness
+				<<","<<summary.interquartile_range<<","<<summary.num_of_runs_reached
+				<<","<<summary.median_time_to_target_seconds
+				<<","<<summary.median_evaluations_to_target<<endl;
+	}
+
+	if(per_run_results)
+	{
+		out<<endl<<"configuration,run,seed,best_fitness,evaluations,generations,"
+				<<"elapsed_seconds,reached_target,time_to_target_seconds,evaluations_to_target"
+				<<endl;
+		for(const batch_run_result & result : results)
+		{
+			writeCsvString(out, result.configuration);
+			out<<","<<result.run<<","<<result.seed<<","<<result.best_fitness
+					<<","<<result.num_of_evaluations<<","<<result.num_of_generations
+					<<","<<result.elapsed_seconds<<","<<result.target_reached
+					<<","<<result.time_to_target_seconds
+					<<","<<result.evaluations_to_target<<endl;
+		}
+	}
+}
+
+inline void batch_runner::writeJson(ostream & out)
+{
+	out<<"{\n  \"configurations\": [";
+	for(size_t c = 0; c < summaries.size(); c++)
+	{
+		const batch_summary & summary = summaries[c];
+		out<<(c > 0 ? "," : "")<<"\n    {\"configuration\": ";
+		writeJsonString(out, summary.configuration);
+		out<<", \"runs\": "<<summary.num_of_runs;
+		out<<", \"target_fitness\": ";
+		writeJsonNumber(out, summary.target_fitness);
+		out<<", \"best_fitness\": ";
+		writeJsonNumber(out, summary.best_fitness);
+		out<<", \"median_fitness\": ";
+		writeJsonNumber(out, summary.median_fitness);
+		out<<", \"lower_quartile_fitness\": ";
+		writeJsonNumber(out, summary.lower_quartile_fitness);
+		out<<", \"upper_quartile_fitness\": ";
+		writeJsonNumber(out, summary.upper_quartile_fitness);
+		out<<", \"interquartile_range\": ";
+		writeJsonNumber(out, summary.interquartile_range);
+		out<<", \"runs_reached_target\": "<<summary.num_of_runs_reached;
+		out<<", \"median_time_to_target_seconds\": ";
+		writeJsonNumber(out, summary.median_time_to_target_seconds);
+		out<<", \"median_evaluations_to_target\": ";
+		writeJsonNumber(out, summary.median_evaluations_to_target);
+		out<<"}";
+	}
+
+	out<<"\n  ],\n  \"runs\": [";
+	for(size_t i = 0; i < results.size(); i++)
+	{
+		const batch_run_result & result = results[i];
+		out<<(i > 0 ? "," : "")<<"\n    {\"configuration\": ";
+		writeJsonString(out, result.configuration);
+		out<<", \"run\": "<<result.run<<", \"seed\": "<<result.seed;
+		out<<", \"best_fitness\": ";
+		writeJsonNumber(out, result.best_fitness);
+		out<<", \"evaluations\": "<<result.num_of_evaluations
+				<<", \"generations\": "<<result.num_of_generations;
+		out<<", \"elapsed_seconds\": ";
+		writeJsonNumber(out, result.elapsed_seconds);
+		out<<", \"reached_target\": "<<(result.target_reached ? "true" : "false");
+		out<<", \"time_to_target_seconds\": ";
+		writeJsonNumber(out, result.time_to_target_seconds);
+		out<<", \"evaluations_to_target\": "<<result.evaluations_to_target<<"}";
+	}
+	out<<"\n  ]\n}"<<endl;
+}
+
+/**
+ * JSON has no NAN or infinity, they are written as null
+ */
+inline void batch_runner::writeJsonNumber(ostream & out, double value)
+{
+	if(std::isfinite(value))
+	{
+		out<<value;
+	}
+	else
+	{
+		out<<"null";
+	}
+}
+
+inline void batch_runner::writeJsonString(ostream & out, const string & value)
+{
+	out<<'"';
+	for(char c : value)
+	{
+		if(c == '"' || c == '\\')
+		{
+			out<<'\\'<<c;
+		}
+		else if((unsigned char) c < 0x20)
+		{
+			out<<' ';
+		}
+		else
+		{
+			out<<c;
+		}
+	}
+	out<<'"';
+}
+
+/**
+ * a CSV field is quoted (with quotes doubled) if it has a comma or quote
+ */
+inline void batch_runner::writeCsvString(ostream & out, const string & value)
+{
+	if(value.find_first_of(",\"\n") == string::npos)
+	{
+		out<<value;
+		return;
+	}
+
+	out<<'"';
+	for(char c : value)
+	{
+		if(c == '"')
+		{
+			out<<'"';
+		}
+		out<<c;
+	}
+	out<<'"';
+}
+}
+
+#endif /* BATCH_RUNNER_H_ */
@@ -0,0 +1,424 @@
+/*
+ * cma_es.h
+ * Covariance Matrix Adaptation Evolution Strategy (CMA-ES) for continuous variables
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef CMA_ES_H_
+#define CMA_ES_H_
+
+#include <cmath>
+#include "continuous_optimizer.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * eigen decomposition of a symmetric matrix (row major, n x n) with cyclic Jacobi rotations.
+ * eigenvectors are columns of eigenvectors (row major, n x n).
+ * It is meant for small matrices (the cost is O(n^3) for each sweep).
+ */
+inline void symmetricEigen(const vector<double> & matrix, size_t n,
+		vector<double> & eigenvalues, vector<double> & eigenvectors)
+{
+	vector<double> a(matrix);
+	eigenvectors.assign(n*n, 0);
+	for(size_t i = 0; i < n; i++)
+	{
+		eigenvectors[i*n + i] = 1;
+	}
+
+	const int MAX_SWEEPS = 50;
+	for(int sweep = 0; sweep < MAX_SWEEPS; sweep++)
+	{
+		double off_diagonal = 0;
+		for(size_t p = 0; p < n; p++)
+		{
+			for(size_t q = p + 1; q < n; q++)
+			{
+				off_diagonal += a[p*n + q]*a[p*n + q];
+			}
+		}
+		if(off_diagonal < 1e-30)
+		{
+			break;
+		}
+
+		for(size_t p = 0; p < n; p++)
+		{
+			for(size_t q = p + 1; q < n; q++)
+			{
+				const double apq = a[p*n + q];
+				if(abs(apq) < 1e-300)
+				{
+					continue;
+				}
+
+				// rotation that makes a[p][q] zero
+				const double theta = (a[q*n + q] - a[p*n + p])/(2*apq);
+				const double t = (theta >= 0 ? 1 : -1)/(abs(theta) + sqrt(theta*theta + 1));
+				const double c = 1/sqrt(t*t + 1);
+				const double s = t*c;
+
+				for(size_t k = 0; k < n; k++)
+				{
+					const double akp = a[k*n + p];
+					const double akq = a[k*n + q];
+					a[k*n + p] = c*akp - s*akq;
+					a[k*n + q] = s*akp + c*akq;
+				}
+				for(size_t k = 0; k < n; k++)
+				{
+					const double apk = a[p*n + k];
+					const double aqk = a[q*n + k];
+					a[p*n + k] = c*apk - s*aqk;
+					a[q*n + k] = s*apk + c*aqk;
+				}
+				for(size_t k = 0; k < n; k++)
+				{
+					const double vkp = eigenvectors[k*n + p];
+					const double vkq = eigenvectors[k*n + q];
+					eigenvectors[k*n + p] = c*vkp - s*vkq;
+					eigenvectors[k*n + q] = s*vkp + c*vkq;
+				}
+			}
+		}
+	}
+
+	eigenvalues.resize(n);
+	for(size_t i = 0; i < n; i++)
+	{
+		eigenvalues[i] = a[i*n + i];
+	}
+}
+
+/**
+ * COVARIANCE MATRIX ADAPTATION EVOLUTION STRATEGY (cma_es)
+ * ========================================================
+ * (mu/mu_w, lambda)-CMA-ES : each generation lambda solutions are sampled from a
+ * normal distribution N(mean, sigma^2 * C). Mean moves to weighted average of best mu
+ * solutions, C is adapted with rank-one (evolution path) and rank-mu updates, and
+ * step size sigma with cumulative step size adaptation. Default settings of
+ * N. Hansen, "The CMA Evolution Strategy: A Tutorial" are used.
+ *
+ * BOUNDS - a sample out of bounds is sampled again (up to 10 times), and then set
+ * within bounds.
+ *
+ * RESTARTS (IPOP) - when step size becomes too small, covariance is ill-conditioned or
+ * best fitness of recent generations is flat (range below 1e-12), search starts again
+ * from a random mean with doubled lambda (up to set number of restarts), which helps
+ * on functions with many local optima.
+ *
+ * DEFAULT PARAMETERS - lambda = 4 + 3*ln(number of variables), initial sigma 0.3 of
+ * range of variables, 9 restarts.
+ *
+ */
+template<typename RandomEngine = mt19937>
+class cma_es : public continuous_optimizer<RandomEngine>
+{
+public :
+	cma_es(const vector<double> & min_values, const vector<double> & max_values) :
+		continuous_optimizer<RandomEngine>(min_values, max_values)
+	{
+	}
+
+	/**
+	 * optional method for changing default parameter settings
+	 * (lambda 0 means default lambda)
+	 */
+	void setParameters(int lambda, int max_num_generations,
+			double initial_sigma_fraction, unsigned max_restarts)
+	{
+		LAMBDA = lambda > 0 ? lambda : 0;
+		this->MAX_NUM_OF_GENERATIONS = max_num_generations;
+		INITIAL_SIGMA_FRACTION = initial_sigma_fraction;
+		MAX_RESTARTS = max_restarts;
+	}
+
+	/**
+	 * returns number of restarts in last run
+	 */
+	unsigned getNumOfRestarts()
+	{
+		return num_of_restarts;
+	}
+
+	void run() override;
+
+protected:
+	size_t LAMBDA = 0;
+	double INITIAL_SIGMA_FRACTION = 0.3;
+	unsigned MAX_RESTARTS = 9;
+
+private:
+	unsigned num_of_restarts = 0;
+
+	bool runFromRandomMean(size_t lambda);
+};
+
+/**
+ * IMPLEMENTATION OF METHODS OF CLASS "cma_es<RandomEngine>"
+ * ========================================================
+ */
+
+template<typename RandomEngine>
+void cma_es<RandomEngine>::run()
+{
+	this->resetRun();
+	num_of_restarts = 0;
+
+	const size_t n = this->NUM_OF_VARIABLES;
+	size_t lambda = LAMBDA > 0 ? LAMBDA : 4 + (size_t) (3*log((double) n));
+	lambda = max(lambda, (size_t) 4);
+
+	while(runFromRandomMean(lambda) && num_of_restarts < MAX_RESTARTS)
+	{
+		num_of_restarts++;
+		lambda *= 2;
+	}
+}
+
+/**
+ * one CMA-ES run from a random mean, returns true if it should be restarted
+ * (false when stopping criteria say stop)
+ */
+template<typename RandomEngine>
+bool cma_es<RandomEngine>::runFromRandomMean(size_t lambda)
+{
+	const size_t n = this->NUM_OF_VARIABLES;
+	const vector<double> & VAR_MIN_VALUES = this->VAR_MIN_VALUES;
+	const vector<double> & VAR_MAX_VALUES = this->VAR_MAX_VALUES;
+
+	// selection weights
+	const size_t mu = lambda/2;
+	vector<double> weights(mu);
+	double weight_sum = 0;
+	for(size_t i = 0; i < mu; i++)
+	{
+		weights[i] = log(mu + 0.5) - log(i + 1.0);
+		weight_sum += weights[i];
+	}
+	double weight_square_sum = 0;
+	for(double & weight : weights)
+	{
+		weight /= weight_sum;
+		weight_square_sum += weight*weight;
+	}
+	const double mueff = 1/weight_square_sum;
+
+	// adaptation rates
+	const double cc = (4 + mueff/n)/(n + 4 + 2*mueff/n);
+	const double cs = (mueff + 2)/(n + mueff + 5);
+	const double c1 = 2/((n + 1.3)*(n + 1.3) + mueff);
+	const double cmu = min(1 - c1, 2*(mueff - 2 + 1/mueff)/((n + 2)*(n + 2) + mueff));
+	const double damps = 1 + 2*max(0.0, sqrt((mueff - 1)/(n + 1)) - 1) + cs;
+	const double chiN = sqrt((double) n)*(1 - 1.0/(4*n) + 1.0/(21*n*n));
+
+	// initial mean and step size
+	uniform_real_distribution<double> uniform_distribution_0_1(0, 1);
+	normal_distribution<double> normal_distribution_0_1(0, 1);
+	vector<double> mean(n), old_mean(n);
+	double max_range = 0;
+	for(size_t k = 0; k < n; k++)
+	{
+		mean[k] = VAR_MIN_VALUES[k] + uniform_distribution_0_1(this->random_engine)
+			*(VAR_MAX_VALUES[k] - VAR_MIN_VALUES[k]);
+		max_range = max(max_range, VAR_MAX_VALUES[k] - VAR_MIN_VALUES[k]);
+	}
+	double sigma = INITIAL_SIGMA_FRACTION*max_range;
+	const double MIN_STEP_SIZE = 1e-12*max_range;
+
+	// C = B*D^2*B', evolution paths pc and ps
+	vector<double> C(n*n, 0), B(n*n, 0), D(n, 1), eigenvalues;
+	for(size_t k = 0; k < n; k++)
+	{
+		C[k*n + k] = 1;
+		B[k*n + k] = 1;
+	}
+	vector<double> pc(n, 0), ps(n, 0);
+
+	// eigen decomposition is not needed after every generation
+	const size_t EIGEN_INTERVAL = max((size_t) 1, (size_t) (lambda/((c1 + cmu)*n*10)));
+	size_t generations_since_eigen = 0;
+
+	// best fitness of recent generations
+	const size_t HISTORY_LENGTH = 10 + (size_t) ceil(30.0*n/lambda);
+	vector<double> best_fitness_history;
+	best_fitness_history.reserve(HISTORY_LENGTH);
+	size_t history_index = 0;
+
+	vector<vector<double>> samples(lambda, vector<double>(n)), steps(lambda, vector<double>(n));
+	vector<double> sample_fitness(lambda), z(n), bdz(n);
+	vector<size_t> order(lambda);
+	// generations since this restart (ps starts again from zero)
+	size_t num_of_run_generations = 0;
+
+	while(!this->shouldStop())
+	{
+		// sample lambda solutions
+		for(size_t i = 0; i < lambda; i++)
+		{
+			vector<double> & x = samples[i];
+			bool is_within_bounds = false;
+			for(int attempt = 0; attempt < 10 && !is_within_bounds; attempt++)
+			{
+				for(size_t k = 0; k < n; k++)
+				{
+					z[k] = D[k]*normal_distribution_0_1(this->random_engine);
+				}
+				is_within_bounds = true;
+				for(size_t k = 0; k < n; k++)
+				{
+					bdz[k] = 0;
+					for(size_t j = 0; j < n; j++)
+					{
+						bdz[k] += B[k*n + j]*z[j];
+					}
+					x[k] = mean[k] + sigma*bdz[k];
+					is_within_bounds = is_within_bounds
+						&& x[k] >= VAR_MIN_VALUES[k] && x[k] <= VAR_MAX_VALUES[k];
+				}
+			}
+
+			for(size_t k = 0; k < n; k++)
+			{
+				x[k] = this->clip(x[k], k);
+			}
+			sample_fitness[i] = this->evaluate(x);
+		}
+
+		// sort by fitness (best first)
+		for(size_t i = 0; i < lambda; i++)
+		{
+			order[i] = i;
+		}
+		sort(order.begin(), order.end(), [&sample_fitness](size_t i, size_t j)
+		{
+			return sample_fitness[i] > sample_fitness[j];
+		});
+
+		// move mean to weighted average of best mu solutions
+		old_mean = mean;
+		for(size_t k = 0; k < n; k++)
+		{
+			mean[k] = 0;
+			for(size_t i = 0; i < mu; i++)
+			{
+				mean[k] += weights[i]*samples[order[i]][k];
+			}
+		}
+
+		// evolution path of step size : ps = (1 - cs)*ps + sqrt(cs*(2 - cs)*mueff)*C^(-1/2)*(m - m_old)/sigma
+		vector<double> & mean_step = bdz;
+		for(size_t k = 0; k < n; k++)
+		{
+			mean_step[k] = (mean[k] - old_mean[k])/sigma;
+		}
+		for(size_t j = 0; j < n; j++)
+		{
+			// z = D^(-1)*B'*mean_step
+			z[j] = 0;
+			for(size_t k = 0; k < n; k++)
+			{
+				z[j] += B[k*n + j]*mean_step[k];
+			}
+			z[j] /= D[j];
+		}
+		const double ps_factor = sqrt(cs*(2 - cs)*mueff);
+		double ps_norm = 0;
+		for(size_t k = 0; k < n; k++)
+		{
+			double c_inv_sqrt_step = 0;
+			for(size_t j = 0; j < n; j++)
+			{
+				c_inv_sqrt_step += B[k*n + j]*z[j];
+			}
+			ps[k] = (1 - cs)*ps[k] + ps_factor*c_inv_sqrt_step;
+			ps_norm += ps[k]*ps[k];
+		}
+		ps_norm = sqrt(ps_norm);
+
+		const double generations = ++num_of_run_generations;
+		const bool hsig = ps_norm/sqrt(1 - pow(1 - cs, 2*generations))/chiN
+			< 1.4 + 2.0/(n + 1);
+
+		// evolution path of covariance
+		const double pc_factor = hsig ? sqrt(cc*(2 - cc)*mueff) : 0;
+		for(size_t k = 0; k < n; k++)
+		{
+			pc[k] = (1 - cc)*pc[k] + pc_factor*mean_step[k];
+		}
+
+		// rank-one and rank-mu update of covariance
+		for(size_t i = 0; i < mu; i++)
+		{
+			for(size_t k = 0; k < n; k++)
+			{
+				steps[i][k] = (samples[order[i]][k] - old_mean[k])/sigma;
+			}
+		}
+		const double old_weight = 1 - c1 - cmu + (hsig ? 0 : c1*cc*(2 - cc));
+		for(size_t k = 0; k < n; k++)
+		{
+			for(size_t j = 0; j <= k; j++)
+			{
+				double rank_mu = 0;
+				for(size_t i = 0; i < mu; i++)
+				{
+					rank_mu += weights[i]*steps[i][k]*steps[i][j];
+				}
+				const double value = old_weight*C[k*n + j] + c1*pc[k]*pc[j] + cmu*rank_mu;
+				C[k*n + j] = value;
+				C[j*n + k] = value;
+			}
+		}
+
+		// step size
+		sigma *= exp((cs/damps)*(ps_norm/chiN - 1));
+
+		// B and D from C
+		if(++generations_since_eigen >= EIGEN_INTERVAL)
+		{
+			generations_since_eigen = 0;
+			symmetricEigen(C, n, eigenvalues, B);
+			for(size_t k = 0; k < n; k++)
+			{
+				D[k] = sqrt(max(eigenvalues[k], 1e-30));
+			}
+		}
+
+		this->endGeneration(sample_fitness.data(), lambda);
+
+		// restart when step size is too small, C is ill-conditioned
+		// or best fitness of recent generations is flat
+		if(best_fitness_history.size() < HISTORY_LENGTH)
+		{
+			best_fitness_history.push_back(sample_fitness[order[0]]);
+		}
+		else
+		{
+			best_fitness_history[history_index] = sample_fitness[order[0]];
+			history_index = (history_index + 1) % HISTORY_LENGTH;
+		}
+		const bool is_flat = best_fitness_history.size() == HISTORY_LENGTH
+			&& *max_element(best_fitness_history.begin(), best_fitness_history.end())
+			- *min_element(best_fitness_history.begin(), best_fitness_history.end()) < 1e-12;
+
+		const double max_d = *max_element(D.begin(), D.end());
+		const double min_d = *min_element(D.begin(), D.end());
+		if(sigma*max_d < MIN_STEP_SIZE || max_d > 1e7*min_d || is_flat
+				|| !std::isfinite(sigma))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// end of definitions
+}
+
+#endif /* CMA_ES_H_ */
@@ -0,0 +1,263 @@
+/*
+ * continuous_optimizer.h
+ * Common part of optimizers for continuous variables (Differential Evolution, CMA-ES)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef CONTINUOUS_OPTIMIZER_H_
+#define CONTINUOUS_OPTIMIZER_H_
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <float.h>
+#include "util/random_engines.h"
+#include "stopping_criteria.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * CONTINUOUS OPTIMIZER (continuous_optimizer)
+ * ===========================================
+ * Base class of optimizers that search real valued variables in given bounds
+ * [VAR_MIN_VALUES, VAR_MAX_VALUES] (see "differential_evolution.h" and "cma_es.h").
+ *
+ * FUNCTION MAXIMIZATION
+ * Same as simple_ga, fitness is maximized. Problems that would find a minima
+ * should use a negative value of the function.
+ *
+ * Statistics of a run (number of evaluations, best fitness, ...) are kept in
+ * ga_statistics, so that same stopping criteria can be set as on simple_ga
+ * (see "stopping_criteria.h"). Evaluation in which best fitness was found is
+ * noted after each evaluation.
+ *
+ * --- PURE VIRTUAL METHODS TO IMPLEMENT ---
+ * 1. double getFitness(const vector<double> & variables) - fitness of a solution
+ *
+ */
+template<typename RandomEngine = mt19937>
+class continuous_optimizer
+{
+public :
+	typedef RandomEngine random_engine_type;
+
+	continuous_optimizer(const vector<double> & min_values, const vector<double> & max_values) :
+		VAR_MIN_VALUES(min_values), VAR_MAX_VALUES(max_values)
+	{
+		if(min_values.size() != max_values.size())
+		{
+			cerr<<"error number of min values : "<<min_values.size()
+					<<" is not equal to number of max values : "<<max_values.size()
+					<<" (extra values are ignored)"<<endl;
+			VAR_MIN_VALUES.resize(min(min_values.size(), max_values.size()));
+			VAR_MAX_VALUES.resize(VAR_MIN_VALUES.size());
+		}
+		NUM_OF_VARIABLES = VAR_MIN_VALUES.size();
+		setSeed(DEFAULT_SEED);
+	}
+
+	virtual ~continuous_optimizer() { }
+
+	/**
+	 * optional method for setting seed of random engine
+	 */
+	void setSeed(uint64_t seed)
+	{
+		random_engine = random_engine_traits<random_engine_type>::create(seed);
+	}
+
+	/**
+	 * optional method for setting a stopping criterion, it is checked after each
+	 * generation in addition to maximum number of generations (NULL removes it)
+	 */
+	void setStoppingCriterion(const stopping_criterionP & criterion)
+	{
+		stopping_criterion_ptr = criterion;
+	}
+
+	/**
+	 * optional method for switching off display of progress during a run
+	 */
+	void setVerbose(bool verbose)
+	{
+		VERBOSE = verbose;
+	}
+
+	/**
+	 * run optimizer
+	 */
+	virtual void run() = 0;
+
+	/**
+	 * displays results after a run
+	 */
+	void displayResults()
+	{
+		cout<<endl<<"total number of generations - "<<statistics.num_of_generations<<endl;
+		cout<<"total number of evaluations - "<<statistics.num_of_evaluations<<endl;
+		cout<<"evaluations to find best fitness - "<<statistics.best_fitness_evaluation<<endl;
+		cout<<"best fitness found - "<<best_fitness<<endl;
+		cout<<"best solution - "<<endl;
+		displaySolution(best_solution);
+	}
+
+	/**
+	 * returns current number of fitness calculations
+	 */
+	unsigned long long getNumOfEvaluations()
+	{
+		return statistics.num_of_evaluations;
+	}
+
+	/**
+	 * returns statistics of current run
+	 */
+	const ga_statistics & getStatistics()
+	{
+		return statistics;
+	}
+
+	/**
+	 * returns the best solution known so far
+	 */
+	const vector<double> & getBestSolution()
+	{
+		return best_solution;
+	}
+
+	/**
+	 * returns the best fitness known so far
+	 */
+	double getBestFitness()
+	{
+		return best_fitness;
+	}
+
+protected:
+	vector<double> VAR_MIN_VALUES;
+	vector<double> VAR_MAX_VALUES;
+	size_t NUM_OF_VARIABLES = 0;
+
+	int MAX_NUM_OF_GENERATIONS = 1000;
+	bool VERBOSE = true;
+
+	random_engine_type random_engine;
+
+	// best known so far
+	vector<double> best_solution;
+	double best_fitness = - DBL_MAX;
+
+	ga_statistics statistics;
+	stopping_criterionP stopping_criterion_ptr;
+
+	// calculate fitness of a solution (implement fitness function)
+	virtual double getFitness(const vector<double> & variables) = 0;
+
+	// display a solution (can optionally be overridden)
+	virtual void displaySolution(const vector<double> & variables)
+	{
+		for(size_t k = 0; k < variables.size(); k++)
+		{
+			cout<<"x"<<k<<" = "<<variables[k]<<(k + 1 < variables.size() ? ", " : "\n");
+		}
+	}
+
+	/**
+	 * stop at maximum number of generations (negative means no limit)
+	 * or when stopping criterion says stop
+	 */
+	virtual bool shouldStop()
+	{
+		return (MAX_NUM_OF_GENERATIONS >= 0
+				&& statistics.num_of_generations >= MAX_NUM_OF_GENERATIONS)
+			|| (stopping_criterion_ptr && stopping_criterion_ptr->shouldStop(statistics));
+	}
+
+	/**
+	 * reset statistics and best solution at start of a run
+	 */
+	void resetRun()
+	{
+		statistics = ga_statistics();
+		statistics.start_time = chrono::steady_clock::now();
+		// nothing is evaluated yet (so that no target fitness is reached)
+		statistics.best_fitness = - DBL_MAX;
+		if(stopping_criterion_ptr)
+		{
+			stopping_criterion_ptr->reset();
+		}
+
+		best_solution.assign(NUM_OF_VARIABLES, 0);
+		best_fitness = - DBL_MAX;
+	}
+
+	/**
+	 * calculate fitness of a solution, count it and note if it is best so far
+	 */
+	double evaluate(const vector<double> & variables)
+	{
+		const double fitness = getFitness(variables);
+		statistics.num_of_evaluations++;
+
+		if(fitness > best_fitness)
+		{
+			best_fitness = fitness;
+			best_solution = variables;
+
+			statistics.best_fitness = best_fitness;
+			statistics.best_fitness_generation = statistics.num_of_generations;
+			statistics.best_fitness_evaluation = statistics.num_of_evaluations;
+			statistics.best_fitness_elapsed_seconds = chrono::duration<double>(
+					chrono::steady_clock::now() - statistics.start_time).count();
+		}
+		return fitness;
+	}
+
+	/**
+	 * count a completed generation and update statistics with its fitness values,
+	 * and display best fitness found so far
+	 */
+	void endGeneration(const double * fitness, size_t num_of_solutions)
+	{
+		statistics.num_of_generations++;
+
+		double fitness_sum = 0;
+		statistics.gen_best_fitness = - DBL_MAX;
+		statistics.gen_min_fitness = DBL_MAX;
+		for(size_t i = 0; i < num_of_solutions; i++)
+		{
+			fitness_sum += fitness[i];
+			statistics.gen_best_fitness = max(statistics.gen_best_fitness, fitness[i]);
+			statistics.gen_min_fitness = min(statistics.gen_min_fitness, fitness[i]);
+		}
+		statistics.avg_fitness = fitness_sum/num_of_solutions;
+		statistics.elapsed_seconds = chrono::duration<double>(
+				chrono::steady_clock::now() - statistics.start_time).count();
+
+		if(VERBOSE)
+		{
+			cout<<"generation : "<<statistics.num_of_generations
+					<<" best fitness : "<<best_fitness<<endl;
+		}
+	}
+
+	/**
+	 * value of k-th variable set within its bounds
+	 */
+	double clip(double value, size_t k)
+	{
+		return min(max(value, VAR_MIN_VALUES[k]), VAR_MAX_VALUES[k]);
+	}
+
+private:
+	static constexpr uint64_t DEFAULT_SEED = 5489;
+};
+}
+
+#endif /* CONTINUOUS_OPTIMIZER_H_ */
@@ -0,0 +1,217 @@
+/*
+ * differential_evolution.h
+ * Differential Evolution (DE) for continuous variables
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef DIFFERENTIAL_EVOLUTION_H_
+#define DIFFERENTIAL_EVOLUTION_H_
+
+#include "continuous_optimizer.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * DIFFERENTIAL EVOLUTION (differential_evolution)
+ * ===============================================
+ * For each member x of population a mutant vector is created from difference of two
+ * other random members r2 and r3 (both different from x and from each other) :
+ *     DE/rand/1 - mutant = r1 + F*(r2 - r3)   (r1 is a third random member)
+ *     DE/best/1 - mutant = best + F*(r2 - r3)
+ * A trial vector takes each variable from mutant with probability CR (binomial
+ * crossover, at least one variable is taken from mutant), otherwise from x.
+ * Trial replaces x in next generation if its fitness is not worse.
+ *
+ * A variable of mutant that is out of bounds is set half way between
+ * the bound and the variable of x (so it stays within bounds).
+ *
+ * DEFAULT PARAMETERS - population size 10*number of variables (at least 20),
+ * F = 0.5, CR = 0.9, strategy DE/rand/1/bin.
+ *
+ */
+template<typename RandomEngine = mt19937>
+class differential_evolution : public continuous_optimizer<RandomEngine>
+{
+public :
+	enum de_strategy { RAND_1_BIN, BEST_1_BIN };
+
+	differential_evolution(const vector<double> & min_values, const vector<double> & max_values) :
+		continuous_optimizer<RandomEngine>(min_values, max_values)
+	{
+		POPULATION_SIZE = max((size_t) 20, 10*this->NUM_OF_VARIABLES);
+		if(this->NUM_OF_VARIABLES == 0)
+		{
+			cerr<<"error number of variables : 0 (0 is not allowed)"<<endl;
+		}
+	}
+
+	/**
+	 * optional method for changing default parameter settings
+	 */
+	void setParameters(int population_size, int max_num_generations,
+			double differential_weight, double crossover_prob)
+	{
+		if(population_size >= 4)
+		{
+			POPULATION_SIZE = population_size;
+		}
+		else
+		{
+			cerr<<"error population size : "<<population_size<<" (size < 4 is not allowed)."
+					<<" keeping size "<<POPULATION_SIZE<<endl;
+		}
+
+		this->MAX_NUM_OF_GENERATIONS = max_num_generations;
+		DIFFERENTIAL_WEIGHT = differential_weight;
+		CROSSOVER_PROBABILITY = crossover_prob;
+	}
+
+	/**
+	 * optional method for selecting base vector of mutant (DE/rand/1/bin by default)
+	 */
+	void setStrategy(de_strategy strategy)
+	{
+		STRATEGY = strategy;
+	}
+
+	void run() override;
+
+protected:
+	size_t POPULATION_SIZE = 20;
+	double DIFFERENTIAL_WEIGHT = 0.5;
+	double CROSSOVER_PROBABILITY = 0.9;
+	de_strategy STRATEGY = RAND_1_BIN;
+
+private:
+	vector<vector<double>> population;
+	vector<double> population_fitness;
+
+	size_t randomMember(uniform_int_distribution<size_t> & member_distribution,
+			size_t excluded1, size_t excluded2, size_t excluded3);
+};
+
+/**
+ * IMPLEMENTATION OF METHODS OF CLASS "differential_evolution<RandomEngine>"
+ * ========================================================================
+ */
+
+template<typename RandomEngine>
+void differential_evolution<RandomEngine>::run()
+{
+	const size_t NUM_OF_VARIABLES = this->NUM_OF_VARIABLES;
+	this->resetRun();
+
+	// atleast 1 variable required
+	if(NUM_OF_VARIABLES == 0)
+	{
+		cerr<<"error cannot perform DE without variables"<<endl;
+		return;
+	}
+
+	// random initial population within bounds
+	population.assign(POPULATION_SIZE, vector<double>(NUM_OF_VARIABLES));
+	population_fitness.resize(POPULATION_SIZE);
+	uniform_real_distribution<double> uniform_distribution_0_1(0, 1);
+	size_t best_index = 0;
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		for(size_t k = 0; k < NUM_OF_VARIABLES; k++)
+		{
+			population[i][k] = this->VAR_MIN_VALUES[k] + uniform_distribution_0_1(this->random_engine)
+				*(this->VAR_MAX_VALUES[k] - this->VAR_MIN_VALUES[k]);
+		}
+		population_fitness[i] = this->evaluate(population[i]);
+		if(population_fitness[i] > population_fitness[best_index])
+		{
+			best_index = i;
+		}
+	}
+
+	uniform_int_distribution<size_t> member_distribution(0, POPULATION_SIZE - 1);
+	uniform_int_distribution<size_t> variable_distribution(0, NUM_OF_VARIABLES - 1);
+	vector<vector<double>> next_population(population);
+	vector<double> next_population_fitness(population_fitness);
+	vector<double> trial(NUM_OF_VARIABLES);
+
+	while(!this->shouldStop())
+	{
+		for(size_t i = 0; i < POPULATION_SIZE; i++)
+		{
+			const size_t r1 = STRATEGY == BEST_1_BIN ? best_index
+				: randomMember(member_distribution, i, i, i);
+			const size_t r2 = randomMember(member_distribution, i, r1, r1);
+			const size_t r3 = randomMember(member_distribution, i, r1, r2);
+
+			// binomial crossover of mutant with current member
+			const size_t forced_variable = variable_distribution(this->random_engine);
+			for(size_t k = 0; k < NUM_OF_VARIABLES; k++)
+			{
+				if(k == forced_variable
+						|| uniform_distribution_0_1(this->random_engine) < CROSSOVER_PROBABILITY)
+				{
+					double value = population[r1][k]
+						+ DIFFERENTIAL_WEIGHT*(population[r2][k] - population[r3][k]);
+					if(value < this->VAR_MIN_VALUES[k])
+					{
+						value = (this->VAR_MIN_VALUES[k] + population[i][k])/2;
+					}
+					else if(value > this->VAR_MAX_VALUES[k])
+					{
+						value = (this->VAR_MAX_VALUES[k] + population[i][k])/2;
+					}
+					trial[k] = value;
+				}
+				else
+				{
+					trial[k] = population[i][k];
+				}
+			}
+
+			// greedy selection
+			const double trial_fitness = this->evaluate(trial);
+			if(trial_fitness >= population_fitness[i])
+			{
+				next_population[i] = trial;
+				next_population_fitness[i] = trial_fitness;
+			}
+			else
+			{
+				next_population[i] = population[i];
+				next_population_fitness[i] = population_fitness[i];
+			}
+		}
+
+		population.swap(next_population);
+		population_fitness.swap(next_population_fitness);
+
+		best_index = max_element(population_fitness.begin(), population_fitness.end())
+			- population_fitness.begin();
+		this->endGeneration(population_fitness.data(), POPULATION_SIZE);
+	}
+}
+
+/**
+ * a random member of population that is not one of the excluded members
+ */
+template<typename RandomEngine>
+size_t differential_evolution<RandomEngine>::randomMember(
+		uniform_int_distribution<size_t> & member_distribution,
+		size_t excluded1, size_t excluded2, size_t excluded3)
+{
+	size_t member;
+	do
+	{
+		member = member_distribution(this->random_engine);
+	}
+	while(member == excluded1 || member == excluded2 || member == excluded3);
+	return member;
+}
+
+// end of definitions
+}
+
+#endif /* DIFFERENTIAL_EVOLUTION_H_ */
@@ -0,0 +1,196 @@
+/*
+ * diversity.h
+ * Diversity of a population (unique individuals, mean distance, allele entropy)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef DIVERSITY_H_
+#define DIVERSITY_H_
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <unordered_set>
+#include <unordered_map>
+#include <type_traits>
+#include "util/genome_traits.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * DIVERSITY OF A POPULATION
+ * =========================
+ * countUniqueIndivs - number of distinct individuals, O(N) expected
+ * estimateMeanDistance - mean distance between two distinct individuals,
+ *                        estimated from random pairs, O(number of pairs)
+ * meanAlleleEntropy - mean entropy (in bits) of alleles at each position,
+ *                     alleles are counted in one pass over population
+ *                     (vectors of integers only, NaN otherwise)
+ *
+ * Individuals are compared with genome_traits (see "util/genome_traits.h").
+ *
+ */
+template<typename T>
+size_t countUniqueIndivs(const T * const * indivs, size_t num_of_indivs)
+{
+	if(!genome_traits<T>::is_supported)
+	{
+		return 0;
+	}
+
+	struct indiv_hash
+	{
+		size_t operator()(const T * indivP) const
+		{
+			return genome_traits<T>::hash(*indivP);
+		}
+	};
+
+	struct indiv_equal
+	{
+		bool operator()(const T * indivP1, const T * indivP2) const
+		{
+			return genome_traits<T>::equal(*indivP1, *indivP2);
+		}
+	};
+
+	unordered_set<const T *, indiv_hash, indiv_equal> unique_indivs(2*num_of_indivs);
+	for(size_t i = 0; i < num_of_indivs; i++)
+	{
+		unique_indivs.insert(*(indivs + i));
+	}
+	return unique_indivs.size();
+}
+
+template<typename T, typename RandomEngine>
+double estimateMeanDistance(const T * const * indivs, size_t num_of_indivs,
+		size_t num_of_pairs, RandomEngine & random_engine)
+{
+	if(!genome_traits<T>::is_supported || num_of_indivs < 2 || num_of_pairs == 0)
+	{
+		return numeric_limits<double>::quiet_NaN();
+	}
+
+	uniform_int_distribution<size_t> first_distribution(0, num_of_indivs - 1);
+	// second index is drawn from remaining individuals, so both are different
+	uniform_int_distribution<size_t> second_distribution(0, num_of_indivs - 2);
+
+	double distance_sum = 0;
+	for(size_t p = 0; p < num_of_pairs; p++)
+	{
+		const size_t first_index = first_distribution(random_engine);
+		size_t second_index = second_distribution(random_engine);
+		if(second_index >= first_index)
+		{
+			second_index++;
+		}
+		distance_sum += genome_traits<T>::distance(*(*(indivs + first_index)),
+				*(*(indivs + second_index)));
+	}
+	return distance_sum/num_of_pairs;
+}
+
+template<typename T>
+double meanAlleleEntropy(const T * const * indivs, size_t num_of_indivs)
+{
+	return numeric_limits<double>::quiet_NaN();
+}
+
+/**
+ * entropy of alleles at each position of vectors of integers (e.g. permutations).
+ * Alleles are counted in a table of (position, allele value) when values lie in
+ * a small range (as for permutations), otherwise in a hash map of each position.
+ */
+template<typename U>
+typename enable_if<is_integral<U>::value, double>::type
+meanAlleleEntropy(const vector<U> * const * indivs, size_t num_of_indivs)
+{
+	if(num_of_indivs == 0)
+	{
+		return numeric_limits<double>::quiet_NaN();
+	}
+
+	size_t length = (*indivs)->size();
+	long long min_allele = numeric_limits<long long>::max();
+	long long max_allele = numeric_limits<long long>::min();
+	for(size_t i = 0; i < num_of_indivs; i++)
+	{
+		const vector<U> & indiv = *(*(indivs + i));
+		length = min(length, indiv.size());
+		for(const U & allele : indiv)
+		{
+			min_allele = min(min_allele, (long long) allele);
+			max_allele = max(max_allele, (long long) allele);
+		}
+	}
+	if(length == 0)
+	{
+		return numeric_limits<double>::quiet_NaN();
+	}
+
+	const double inverse_num_of_indivs = 1.0/num_of_indivs;
+	double entropy_sum = 0;
+	auto addToEntropy = [&](size_t count)
+	{
+		const double probability = count*inverse_num_of_indivs;
+		entropy_sum -= probability*log2(probability);
+	};
+
+	const double range = (double) max_allele - min_allele + 1;
+	const size_t MAX_TABLE_SIZE = size_t(1) << 22;
+	if(range*length <= MAX_TABLE_SIZE)
+	{
+		// count all positions in one pass over population
+		const size_t num_of_values = (size_t) range;
+		vector<unsigned> counts(length*num_of_values, 0);
+		for(size_t i = 0; i < num_of_indivs; i++)
+		{
+			const vector<U> & indiv = *(*(indivs + i));
+			unsigned * position_counts = counts.data();
+			for(size_t k = 0; k < length; k++, position_counts += num_of_values)
+			{
+				position_counts[(long long) indiv[k] - min_allele]++;
+			}
+		}
+
+		for(unsigned count : counts)
+		{
+			if(count > 0)
+			{
+				addToEntropy(count);
+			}
+		}
+	}
+	else
+	{
+		// count each position in a hash map, also in one pass over population
+		vector<unordered_map<U, unsigned>> position_counts(length);
+		for(size_t i = 0; i < num_of_indivs; i++)
+		{
+			const vector<U> & indiv = *(*(indivs + i));
+			for(size_t k = 0; k < length; k++)
+			{
+				position_counts[k][indiv[k]]++;
+			}
+		}
+
+		for(const unordered_map<U, unsigned> & counts : position_counts)
+		{
+			for(const pair<const U, unsigned> & count : counts)
+			{
+				addToEntropy(count.second);
+			}
+		}
+	}
+
+	return entropy_sum/length;
+}
+}
+
+#endif /* DIVERSITY_H_ */
@@ -0,0 +1,38 @@
+/*
+ * fitness_evaluator.h
+ * Interface for evaluating fitness of individuals outside of simple_ga
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef FITNESS_EVALUATOR_H_
+#define FITNESS_EVALUATOR_H_
+
+#include <cstddef>
+
+namespace ga
+{
+/**
+ * FITNESS EVALUATOR
+ * =================
+ * A backend that calculates fitness of a batch of individuals in place of
+ * getFitness of simple_ga (e.g. in other processes or on other machines).
+ *
+ * evaluate() sets fitness[i] for individual *indivs[i]. An individual that
+ * could not be evaluated by the backend gets NaN as its fitness, and it is
+ * then evaluated by GA itself with getFitness.
+ *
+ */
+template<typename T>
+class fitness_evaluator
+{
+public :
+	virtual void evaluate(const T * const * indivs, double * fitness,
+			size_t num_of_indivs) = 0;
+
+	virtual ~fitness_evaluator() { }
+};
+}
+
+#endif /* FITNESS_EVALUATOR_H_ */
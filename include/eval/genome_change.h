@@ -0,0 +1,64 @@
+/*
+ * genome_change.h
+ * Record of alleles changed by genetic operators (for delta evaluation)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef GENOME_CHANGE_H_
+#define GENOME_CHANGE_H_
+
+#include <cstddef>
+#include <vector>
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * GENOME CHANGE (genome_change)
+ * =============================
+ * Positions of alleles in which an offspring differs from one of the parents
+ * (its base), noted by crossover and mutation while the offspring is bred.
+ * Fitness of offspring can then be calculated from fitness of base parent and
+ * the changed alleles (getFitnessDelta of simple_ga), in O(changes) instead of
+ * O(genome).
+ *
+ * A position may be noted more than once (e.g. when two mutations swap it).
+ * An offspring is fully evaluated if its base parent is not known or its changes
+ * could not be listed (is_complete is false).
+ *
+ */
+struct genome_change
+{
+	static const long long NO_PARENT = -1;
+
+	// index (in population) of base parent, NO_PARENT if not known
+	long long parent_index = NO_PARENT;
+
+	// positions of changed alleles
+	vector<size_t> positions;
+
+	// false if not all changes are in positions
+	bool is_complete = true;
+
+	/**
+	 * start a new record for an offspring based on given parent
+	 * (memory of positions is kept)
+	 */
+	void reset(long long base_parent_index)
+	{
+		parent_index = base_parent_index;
+		positions.clear();
+		is_complete = true;
+	}
+
+	bool isUsable() const
+	{
+		return is_complete && parent_index != NO_PARENT;
+	}
+};
+}
+
+#endif /* GENOME_CHANGE_H_ */
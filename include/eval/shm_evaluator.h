@@ -0,0 +1,244 @@
+/*
+ * shm_evaluator.h
+ * Evaluation of fitness in local worker processes over shared memory
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef SHM_EVALUATOR_H_
+#define SHM_EVALUATOR_H_
+
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <type_traits>
+#include "eval/fitness_evaluator.h"
+#include "eval/shm_protocol.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * SHARED MEMORY EVALUATOR (shm_evaluator)
+ * =======================================
+ * A fitness evaluator (master) for worker processes on the same machine
+ * (see shm_worker.h). Individuals are copied as they are into genome slots of a
+ * shared memory segment, and workers calculate fitness from the slots in place,
+ * so nothing is encoded, sent or decoded (unlike tcp_evaluator).
+ *
+ * BATCHES - slots of a generation are requested in batches of BATCH_SIZE
+ * consecutive slots, each batch is taken by one free worker.
+ *
+ * SLOTS - a generation larger than number of slots is evaluated in parts.
+ *
+ * TIMEOUT - if no result arrives for REPLY_TIMEOUT_MS (e.g. all workers died or no
+ * worker was started), remaining individuals get NaN as fitness (and are evaluated
+ * by GA). Late results of these individuals are dropped.
+ *
+ * Segment is removed when the evaluator is destroyed, which also stops its workers.
+ * Individuals must be trivially copyable (e.g. a struct of doubles or a std::array),
+ * since they are used in other processes as raw bytes.
+ *
+ */
+template<typename T>
+class shm_evaluator : public fitness_evaluator<T>
+{
+	static_assert(is_trivially_copyable<T>::value,
+			"individuals in shared memory must be trivially copyable");
+	static_assert(alignof(T) <= SHM_CACHE_LINE_SIZE,
+			"genome slots are aligned to a cache line");
+
+public :
+	/**
+	 * create a segment with given name (must start with '/') and number of slots
+	 */
+	explicit shm_evaluator(const string & segment_name, size_t num_of_slots = 1024);
+	~shm_evaluator();
+
+	/**
+	 * optional methods for changing default settings
+	 */
+	void setBatchSize(size_t batch_size);
+	void setReplyTimeout(int reply_timeout_ms);
+
+	void evaluate(const T * const * indivs, double * fitness, size_t num_of_indivs) override;
+
+	/**
+	 * returns false if segment could not be created
+	 * (then every individual is evaluated by GA)
+	 */
+	bool isOpen() const
+	{
+		return segment.base != NULL;
+	}
+
+	const string & getSegmentName() const
+	{
+		return name;
+	}
+
+	/**
+	 * returns number of times that remaining individuals were given up after a timeout
+	 */
+	size_t getNumOfTimeouts()
+	{
+		return num_of_timeouts;
+	}
+
+private:
+	size_t BATCH_SIZE = 16;
+	int REPLY_TIMEOUT_MS = 60000;
+
+	string name;
+	shm_segment segment;
+	uint32_t next_batch_id = 0;
+	size_t num_of_timeouts = 0;
+
+	// is_received[slot] is true if fitness of slot is received
+	vector<bool> is_received;
+
+	// non-copyable since it owns the segment
+	shm_evaluator(const shm_evaluator & _shm_evaluator);
+	shm_evaluator & operator=(const shm_evaluator & _shm_evaluator);
+
+	bool evaluatePart(const T * const * indivs, double * fitness, size_t num_of_indivs);
+};
+
+/**
+ * IMPLEMENTATION OF METHODS OF CLASS "shm_evaluator<T>"
+ * =====================================================
+ */
+
+template<typename T>
+shm_evaluator<T>::shm_evaluator(const string & segment_name, size_t num_of_slots)
+	: name(segment_name)
+{
+	if(num_of_slots < 1 || num_of_slots > numeric_limits<uint32_t>::max())
+	{
+		cerr<<"error invalid number of slots : "<<num_of_slots<<", using 1024 slots"<<endl;
+		num_of_slots = 1024;
+	}
+	if(shmCreate(name, sizeof(T), num_of_slots, segment))
+	{
+		is_received.resize(num_of_slots);
+	}
+}
+
+/**
+ * close segment (workers stop when they see it) and remove its name
+ */
+template<typename T>
+shm_evaluator<T>::~shm_evaluator()
+{
+	if(isOpen())
+	{
+		segment.headerP->is_closed.store(1);
+		segment.requests.wakeAll();
+		shmUnmap(segment);
+		shm_unlink(name.c_str());
+	}
+}
+
+template<typename T>
+void shm_evaluator<T>::setBatchSize(size_t batch_size)
+{
+	if(batch_size >= 1)
+	{
+		BATCH_SIZE = batch_size;
+	}
+}
+
+template<typename T>
+void shm_evaluator<T>::setReplyTimeout(int reply_timeout_ms)
+{
+	REPLY_TIMEOUT_MS = reply_timeout_ms;
+}
+
+/**
+ * evaluate individuals in parts of (at most) number of slots,
+ * parts after a timed out part are not requested
+ */
+template<typename T>
+void shm_evaluator<T>::evaluate(const T * const * indivs, double * fitness,
+		size_t num_of_indivs)
+{
+	if(!isOpen())
+	{
+		fill(fitness, fitness + num_of_indivs, numeric_limits<double>::quiet_NaN());
+		return;
+	}
+
+	const size_t num_of_slots = segment.headerP->num_of_slots;
+	for(size_t begin = 0; begin < num_of_indivs; begin += num_of_slots)
+	{
+		if(!evaluatePart(indivs + begin, fitness + begin,
+				min(num_of_slots, num_of_indivs - begin)))
+		{
+			fill(fitness + min(begin + num_of_slots, num_of_indivs), fitness + num_of_indivs,
+					numeric_limits<double>::quiet_NaN());
+			return;
+		}
+	}
+}
+
+/**
+ * copy individuals to slots, request them in batches and wait for a result of each slot,
+ * returns false on timeout
+ */
+template<typename T>
+bool shm_evaluator<T>::evaluatePart(const T * const * indivs, double * fitness,
+		size_t num_of_indivs)
+{
+	for(size_t i = 0; i < num_of_indivs; i++)
+	{
+		memcpy(segment.getSlot(i), *(indivs + i), sizeof(T));
+		fitness[i] = numeric_limits<double>::quiet_NaN();
+		is_received[i] = false;
+	}
+
+	// requests of a part are at most number of slots, so that request ring is never full
+	const uint32_t first_batch_id = next_batch_id;
+	for(size_t first = 0; first < num_of_indivs; first += BATCH_SIZE)
+	{
+		shm_request request;
+		request.batch_id = next_batch_id++;
+		request.first_slot = first;
+		request.num_of_slots = min(BATCH_SIZE, num_of_indivs - first);
+		request.reserved = 0;
+		segment.requests.tryPush(request);
+	}
+	const uint32_t num_of_batches = next_batch_id - first_batch_id;
+
+	size_t num_of_pending = num_of_indivs;
+	shm_result result;
+	while(num_of_pending > 0)
+	{
+		if(!segment.results.pop(result, REPLY_TIMEOUT_MS, segment.headerP->is_closed))
+		{
+			cerr<<"error no result from shared memory workers in "<<REPLY_TIMEOUT_MS
+					<<" ms, "<<num_of_pending<<" individual(s) not evaluated"<<endl;
+			num_of_timeouts++;
+
+			// take back requests that no worker took, so that ring does not fill up
+			shm_request stale_request;
+			while(segment.requests.tryPop(stale_request)) { }
+			return false;
+		}
+
+		// drop results of earlier (timed out) requests
+		if((uint32_t) (result.batch_id - first_batch_id) >= num_of_batches
+				|| result.slot >= num_of_indivs || is_received[result.slot])
+		{
+			continue;
+		}
+		fitness[result.slot] = result.fitness;
+		is_received[result.slot] = true;
+		num_of_pending--;
+	}
+	return true;
+}
+}
+
+#endif /* SHM_EVALUATOR_H_ */
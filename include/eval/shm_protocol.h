@@ -0,0 +1,491 @@
+/*
+ * shm_protocol.h
+ * Shared memory segment, lock-free rings and futex helpers shared by
+ * shared memory evaluator and shared memory worker
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef SHM_PROTOCOL_H_
+#define SHM_PROTOCOL_H_
+
+#include <iostream>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <climits>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <new>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * SHARED MEMORY EVALUATION PROTOCOL
+ * =================================
+ * A POSIX shared memory segment (created by master, opened by workers by its name) :
+ *
+ * | header | request ring cells | result ring cells | genome slots |
+ *
+ * genome slots - bytes of one individual each (slot_stride apart), written by master
+ *                and read in place by workers
+ * request ring - batches of consecutive slots to evaluate (master -> workers)
+ * result ring  - fitness of each slot of a batch (workers -> master)
+ *
+ * Rings are bounded lock-free queues (any number of producers and consumers), so
+ * master and workers never take a lock. A consumer of an empty ring spins shortly
+ * and then sleeps on a futex, which each push wakes (only if someone sleeps on it).
+ *
+ * A result carries batch id of its request, so results of a batch that master has
+ * given up on (timed out) are recognized and dropped.
+ *
+ * Atomics of rings are used by several processes, so they must be lock free.
+ *
+ */
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2,
+		"shared memory rings need lock free atomics");
+static_assert(sizeof(atomic<uint32_t>) == sizeof(uint32_t),
+		"futex word must be a plain 32 bit integer");
+
+const uint32_t SHM_SEGMENT_MAGIC = 0x47415348; // "GASH"
+
+const size_t SHM_CACHE_LINE_SIZE = 64;
+
+struct shm_request
+{
+	uint32_t batch_id;
+	uint32_t first_slot;
+	uint32_t num_of_slots;
+	uint32_t reserved;
+};
+
+struct shm_result
+{
+	uint32_t batch_id;
+	uint32_t slot;
+	double fitness;
+};
+
+template<typename E>
+struct shm_ring_cell
+{
+	atomic<uint64_t> sequence;
+	E entry;
+};
+
+/**
+ * positions and futex word of a ring (producers and consumers on own cache lines)
+ */
+struct shm_ring_control
+{
+	alignas(SHM_CACHE_LINE_SIZE) atomic<uint64_t> enqueue_position;
+	alignas(SHM_CACHE_LINE_SIZE) atomic<uint64_t> dequeue_position;
+	alignas(SHM_CACHE_LINE_SIZE) atomic<uint32_t> futex_word;
+	atomic<uint32_t> num_of_waiters;
+	uint64_t capacity;
+};
+
+struct shm_segment_header
+{
+	// set last by master, so that workers do not use a segment being initialized
+	atomic<uint32_t> magic;
+	// set by master when it closes the segment
+	atomic<uint32_t> is_closed;
+	// workers exit if master process is gone
+	int32_t master_pid;
+	uint32_t reserved;
+	uint64_t segment_size;
+	uint64_t genome_size;
+	uint64_t slot_stride;
+	uint64_t num_of_slots;
+	uint64_t ring_capacity;
+	shm_ring_control requests;
+	shm_ring_control results;
+};
+
+/**
+ * offsets of parts of a segment
+ */
+struct shm_layout
+{
+	size_t request_cells_offset;
+	size_t result_cells_offset;
+	size_t slots_offset;
+	size_t segment_size;
+};
+
+inline size_t roundUpToCacheLine(size_t size)
+{
+	return (size + SHM_CACHE_LINE_SIZE - 1)/SHM_CACHE_LINE_SIZE*SHM_CACHE_LINE_SIZE;
+}
+
+inline shm_layout getShmLayout(size_t ring_capacity, size_t slot_stride, size_t num_of_slots)
+{
+	shm_layout layout;
+	layout.request_cells_offset = roundUpToCacheLine(sizeof(shm_segment_header));
+	layout.result_cells_offset = layout.request_cells_offset
+			+ roundUpToCacheLine(ring_capacity*sizeof(shm_ring_cell<shm_request>));
+	layout.slots_offset = layout.result_cells_offset
+			+ roundUpToCacheLine(ring_capacity*sizeof(shm_ring_cell<shm_result>));
+	layout.segment_size = layout.slots_offset + num_of_slots*slot_stride;
+	return layout;
+}
+
+/**
+ * sleep while *word is expected (upto timeout_ms, forever if negative),
+ * returns false on timeout
+ */
+inline bool futexWait(atomic<uint32_t> * word, uint32_t expected, int timeout_ms)
+{
+	timespec timeout;
+	timeout.tv_sec = timeout_ms/1000;
+	timeout.tv_nsec = (timeout_ms%1000)*1000000L;
+	long status = syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAIT, expected,
+			timeout_ms >= 0 ? &timeout : NULL, NULL, 0);
+	return status == 0 || errno != ETIMEDOUT;
+}
+
+inline void futexWake(atomic<uint32_t> * word, int num_of_waiters)
+{
+	syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAKE, num_of_waiters,
+			NULL, NULL, 0);
+}
+
+/**
+ * SHARED MEMORY RING (shm_ring)
+ * =============================
+ * A view of a bounded lock-free queue (Vyukov's) in a shared memory segment.
+ * Each cell has a sequence number, which tells whether the cell is ready to be
+ * written (sequence == position) or read (sequence == position + 1) at a position.
+ *
+ */
+template<typename E>
+class shm_ring
+{
+public :
+	shm_ring() { }
+
+	shm_ring(shm_ring_control * control, shm_ring_cell<E> * cells) :
+		controlP(control), cellsP(cells) { }
+
+	/**
+	 * construct an empty ring (capacity must be a power of 2), only by master
+	 */
+	void init(uint64_t capacity)
+	{
+		new (controlP) shm_ring_control();
+		controlP->capacity = capacity;
+		for(uint64_t c = 0; c < capacity; c++)
+		{
+			new (cellsP + c) shm_ring_cell<E>();
+			cellsP[c].sequence.store(c, memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * returns false if ring is full
+	 */
+	bool tryPush(const E & entry)
+	{
+		const uint64_t mask = controlP->capacity - 1;
+		uint64_t position = controlP->enqueue_position.load(memory_order_relaxed);
+		shm_ring_cell<E> * cellP;
+		for(;;)
+		{
+			cellP = cellsP + (position & mask);
+			const int64_t difference = (int64_t) cellP->sequence.load(memory_order_acquire)
+					- (int64_t) position;
+			if(difference == 0)
+			{
+				if(controlP->enqueue_position.compare_exchange_weak(position, position + 1,
+						memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if(difference < 0)
+			{
+				return false;
+			}
+			else
+			{
+				position = controlP->enqueue_position.load(memory_order_relaxed);
+			}
+		}
+
+		cellP->entry = entry;
+		cellP->sequence.store(position + 1, memory_order_release);
+
+		// wake one sleeping consumer
+		controlP->futex_word.fetch_add(1);
+		if(controlP->num_of_waiters.load() > 0)
+		{
+			futexWake(&controlP->futex_word, 1);
+		}
+		return true;
+	}
+
+	/**
+	 * returns false if ring is empty
+	 */
+	bool tryPop(E & entry)
+	{
+		const uint64_t mask = controlP->capacity - 1;
+		uint64_t position = controlP->dequeue_position.load(memory_order_relaxed);
+		shm_ring_cell<E> * cellP;
+		for(;;)
+		{
+			cellP = cellsP + (position & mask);
+			const int64_t difference = (int64_t) cellP->sequence.load(memory_order_acquire)
+					- (int64_t) (position + 1);
+			if(difference == 0)
+			{
+				if(controlP->dequeue_position.compare_exchange_weak(position, position + 1,
+						memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if(difference < 0)
+			{
+				return false;
+			}
+			else
+			{
+				position = controlP->dequeue_position.load(memory_order_relaxed);
+			}
+		}
+
+		entry = cellP->entry;
+		cellP->sequence.store(position + controlP->capacity, memory_order_release);
+		return true;
+	}
+
+	/**
+	 * pop an entry, sleeping on futex while ring is empty (upto timeout_ms, forever
+	 * if negative), returns false on timeout or when is_closed is set
+	 */
+	bool pop(E & entry, int timeout_ms, const atomic<uint32_t> & is_closed)
+	{
+		const size_t SPIN_COUNT = 64;
+		const chrono::steady_clock::time_point deadline = chrono::steady_clock::now()
+				+ chrono::milliseconds(timeout_ms);
+		for(;;)
+		{
+			for(size_t s = 0; s < SPIN_COUNT; s++)
+			{
+				if(tryPop(entry))
+				{
+					return true;
+				}
+			}
+			if(is_closed.load())
+			{
+				return false;
+			}
+
+			// a push after reading futex word changes it, so that futex does not sleep
+			const uint32_t futex_value = controlP->futex_word.load();
+			controlP->num_of_waiters.fetch_add(1);
+			if(tryPop(entry))
+			{
+				controlP->num_of_waiters.fetch_sub(1);
+				return true;
+			}
+
+			int wait_ms = -1;
+			if(timeout_ms >= 0)
+			{
+				wait_ms = chrono::duration_cast<chrono::milliseconds>(
+						deadline - chrono::steady_clock::now()).count();
+				if(wait_ms <= 0)
+				{
+					controlP->num_of_waiters.fetch_sub(1);
+					return tryPop(entry);
+				}
+			}
+			futexWait(&controlP->futex_word, futex_value, wait_ms);
+			controlP->num_of_waiters.fetch_sub(1);
+		}
+	}
+
+	/**
+	 * push an entry, yielding while ring is full, returns false when is_closed is set
+	 */
+	bool push(const E & entry, const atomic<uint32_t> & is_closed)
+	{
+		while(!tryPush(entry))
+		{
+			if(is_closed.load())
+			{
+				return false;
+			}
+			sched_yield();
+		}
+		return true;
+	}
+
+	/**
+	 * wake all sleeping consumers (e.g. when segment is closed)
+	 */
+	void wakeAll()
+	{
+		controlP->futex_word.fetch_add(1);
+		futexWake(&controlP->futex_word, INT_MAX);
+	}
+
+private:
+	shm_ring_control * controlP = NULL;
+	shm_ring_cell<E> * cellsP = NULL;
+};
+
+/**
+ * rings and slots of a mapped segment
+ */
+struct shm_segment
+{
+	char * base = NULL;
+	size_t size = 0;
+	shm_segment_header * headerP = NULL;
+	shm_ring<shm_request> requests;
+	shm_ring<shm_result> results;
+	char * slots = NULL;
+
+	void bind()
+	{
+		headerP = reinterpret_cast<shm_segment_header *>(base);
+		const shm_layout layout = getShmLayout(headerP->ring_capacity,
+				headerP->slot_stride, headerP->num_of_slots);
+		requests = shm_ring<shm_request>(&headerP->requests,
+				reinterpret_cast<shm_ring_cell<shm_request> *>(base + layout.request_cells_offset));
+		results = shm_ring<shm_result>(&headerP->results,
+				reinterpret_cast<shm_ring_cell<shm_result> *>(base + layout.result_cells_offset));
+		slots = base + layout.slots_offset;
+	}
+
+	char * getSlot(size_t slot)
+	{
+		return slots + slot*headerP->slot_stride;
+	}
+};
+
+/**
+ * create and map a new segment with num_of_slots slots of genome_size bytes
+ * (name must start with '/'), returns false on error
+ */
+inline bool shmCreate(const string & name, size_t genome_size, size_t num_of_slots,
+		shm_segment & segment)
+{
+	uint64_t ring_capacity = 1;
+	while(ring_capacity < 2*num_of_slots)
+	{
+		ring_capacity *= 2;
+	}
+	const size_t slot_stride = roundUpToCacheLine(genome_size);
+	const shm_layout layout = getShmLayout(ring_capacity, slot_stride, num_of_slots);
+
+	int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+	if(fd < 0)
+	{
+		cerr<<"error creating shared memory "<<name<<" : "<<strerror(errno)<<endl;
+		return false;
+	}
+	if(ftruncate(fd, layout.segment_size) != 0)
+	{
+		cerr<<"error sizing shared memory "<<name<<" : "<<strerror(errno)<<endl;
+		close(fd);
+		shm_unlink(name.c_str());
+		return false;
+	}
+	void * base = mmap(NULL, layout.segment_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if(base == MAP_FAILED)
+	{
+		cerr<<"error mapping shared memory "<<name<<" : "<<strerror(errno)<<endl;
+		shm_unlink(name.c_str());
+		return false;
+	}
+
+	segment.base = static_cast<char *>(base);
+	segment.size = layout.segment_size;
+	shm_segment_header * headerP = new (base) shm_segment_header();
+	headerP->is_closed.store(0);
+	headerP->master_pid = getpid();
+	headerP->segment_size = layout.segment_size;
+	headerP->genome_size = genome_size;
+	headerP->slot_stride = slot_stride;
+	headerP->num_of_slots = num_of_slots;
+	headerP->ring_capacity = ring_capacity;
+	segment.bind();
+	segment.requests.init(ring_capacity);
+	segment.results.init(ring_capacity);
+	headerP->magic.store(SHM_SEGMENT_MAGIC, memory_order_release);
+	return true;
+}
+
+/**
+ * open and map an existing segment made for genomes of genome_size bytes,
+ * returns false on error
+ */
+inline bool shmOpen(const string & name, size_t genome_size, shm_segment & segment)
+{
+	int fd = shm_open(name.c_str(), O_RDWR, 0);
+	if(fd < 0)
+	{
+		cerr<<"error opening shared memory "<<name<<" : "<<strerror(errno)<<endl;
+		return false;
+	}
+	struct stat status;
+	if(fstat(fd, &status) != 0 || (size_t) status.st_size < sizeof(shm_segment_header))
+	{
+		cerr<<"error invalid shared memory "<<name<<endl;
+		close(fd);
+		return false;
+	}
+	void * base = mmap(NULL, status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if(base == MAP_FAILED)
+	{
+		cerr<<"error mapping shared memory "<<name<<" : "<<strerror(errno)<<endl;
+		return false;
+	}
+
+	const shm_segment_header * headerP = static_cast<const shm_segment_header *>(base);
+	if(headerP->magic.load(memory_order_acquire) != SHM_SEGMENT_MAGIC
+			|| headerP->segment_size != (uint64_t) status.st_size
+			|| headerP->genome_size != genome_size)
+	{
+		cerr<<"error shared memory "<<name<<" is not a segment for genomes of "
+				<<genome_size<<" bytes"<<endl;
+		munmap(base, status.st_size);
+		return false;
+	}
+
+	segment.base = static_cast<char *>(base);
+	segment.size = status.st_size;
+	segment.bind();
+	return true;
+}
+
+inline void shmUnmap(shm_segment & segment)
+{
+	if(segment.base != NULL)
+	{
+		munmap(segment.base, segment.size);
+		segment = shm_segment();
+	}
+}
+}
+
+#endif /* SHM_PROTOCOL_H_ */
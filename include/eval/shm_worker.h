@@ -0,0 +1,94 @@
+/*
+ * shm_worker.h
+ * Worker process side of fitness evaluation over shared memory
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef SHM_WORKER_H_
+#define SHM_WORKER_H_
+
+#include <iostream>
+#include <functional>
+#include <signal.h>
+#include "eval/shm_protocol.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * SHARED MEMORY WORKER
+ * ====================
+ * Opens the segment of a master (shm_evaluator) by its name, takes batches from its
+ * request ring and pushes fitness of each slot of a batch to its result ring.
+ * Fitness is calculated from genome slots in place (individuals are not copied).
+ * Any number of workers can serve one segment.
+ *
+ * segment_name - name of segment given to shm_evaluator
+ * fitness_function - fitness of an individual
+ *
+ * Returns when master closes the segment or master process is gone,
+ * returns false if segment could not be opened.
+ *
+ */
+template<typename T>
+bool runShmWorker(const string & segment_name, const function<double(const T &)> & fitness_function);
+
+
+/**
+ * IMPLEMENTATION OF SHARED MEMORY WORKER
+ * ======================================
+ */
+
+template<typename T>
+bool runShmWorker(const string & segment_name, const function<double(const T &)> & fitness_function)
+{
+	// how often a sleeping worker checks that master process is alive
+	const int MASTER_CHECK_MS = 1000;
+
+	shm_segment segment;
+	if(!shmOpen(segment_name, sizeof(T), segment))
+	{
+		return false;
+	}
+
+	const atomic<uint32_t> & is_closed = segment.headerP->is_closed;
+	const pid_t master_pid = segment.headerP->master_pid;
+	shm_request request;
+	shm_result result;
+	while(!is_closed.load())
+	{
+		if(!segment.requests.pop(request, MASTER_CHECK_MS, is_closed))
+		{
+			if(kill(master_pid, 0) != 0 && errno == ESRCH)
+			{
+				cerr<<"error master process "<<master_pid<<" of shared memory "
+						<<segment_name<<" is gone"<<endl;
+				break;
+			}
+			continue;
+		}
+
+		result.batch_id = request.batch_id;
+		const uint64_t end_slot = min((uint64_t) request.first_slot + request.num_of_slots,
+				segment.headerP->num_of_slots);
+		for(uint64_t slot = request.first_slot; slot < end_slot; slot++)
+		{
+			const T & indiv = *reinterpret_cast<const T *>(segment.getSlot(slot));
+			result.slot = slot;
+			result.fitness = fitness_function(indiv);
+			if(!segment.results.push(result, is_closed))
+			{
+				break;
+			}
+		}
+	}
+
+	shmUnmap(segment);
+	return true;
+}
+}
+
+#endif /* SHM_WORKER_H_ */
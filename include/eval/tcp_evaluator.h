@@ -0,0 +1,467 @@
+/*
+ * tcp_evaluator.h
+ * Evaluation of fitness in worker processes over TCP
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef TCP_EVALUATOR_H_
+#define TCP_EVALUATOR_H_
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <chrono>
+#include <limits>
+#include <poll.h>
+#include "eval/fitness_evaluator.h"
+#include "eval/tcp_protocol.h"
+#include "util/genome_codec.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * TCP EVALUATOR (tcp_evaluator)
+ * =============================
+ * A fitness evaluator (master) that sends batches of individuals to worker
+ * processes (see tcp_worker.h) and receives their fitness values.
+ *
+ * BATCHES - individuals of a generation are split into batches of BATCH_SIZE.
+ *
+ * PIPELINING - each worker can have upto PIPELINE_DEPTH batches sent to it
+ * before its first reply, so that workers do not wait for the master between batches.
+ *
+ * RETRIES - a worker is considered dead when its connection breaks or when it does not
+ * start or complete a reply within REPLY_TIMEOUT_MS. Its outstanding batches are sent to other workers
+ * (upto MAX_RETRIES times for each batch). Dead workers are connected again at
+ * the next call of evaluate(), so restarted workers are used again.
+ * Individuals that could not be evaluated get NaN as fitness (and are evaluated by GA).
+ *
+ * Individuals are converted to bytes with genome_codec<T>.
+ *
+ */
+template<typename T>
+class tcp_evaluator : public fitness_evaluator<T>
+{
+public :
+	explicit tcp_evaluator(const vector<tcp_endpoint> & endpoints);
+	~tcp_evaluator();
+
+	/**
+	 * optional methods for changing default settings
+	 */
+	void setBatchSize(size_t batch_size);
+	void setPipelineDepth(size_t pipeline_depth);
+	void setMaxRetries(size_t max_retries);
+	void setReplyTimeout(int reply_timeout_ms);
+
+	void evaluate(const T * const * indivs, double * fitness, size_t num_of_indivs) override;
+
+	/**
+	 * returns number of workers with an open connection
+	 */
+	size_t getNumOfLiveWorkers();
+
+	/**
+	 * returns total number of batches that were sent again after a worker died
+	 */
+	size_t getNumOfRetries()
+	{
+		return num_of_retries;
+	}
+
+private:
+	size_t BATCH_SIZE = 32;
+	size_t PIPELINE_DEPTH = 2;
+	size_t MAX_RETRIES = 3;
+	int REPLY_TIMEOUT_MS = 60000;
+
+	struct worker_connection
+	{
+		tcp_endpoint endpoint;
+		int socket_fd = -1;
+		// connection error is reported only once until worker is connected again
+		bool connect_error_reported = false;
+		// batches sent and not replied yet (in order of sending)
+		deque<size_t> in_flight;
+		chrono::steady_clock::time_point last_progress;
+	};
+
+	struct batch
+	{
+		size_t begin;
+		size_t end;
+		size_t num_of_retries;
+		uint32_t batch_id;
+	};
+
+	vector<worker_connection> workers;
+	vector<batch> batches;
+	deque<size_t> pending_batches;
+	size_t num_of_done_batches = 0;
+	uint32_t next_batch_id = 0;
+	size_t num_of_retries = 0;
+
+	// buffers for messages
+	string request;
+	vector<double> reply_fitness;
+
+	// non-copyable since it owns open connections
+	tcp_evaluator(const tcp_evaluator & _tcp_evaluator);
+	tcp_evaluator & operator=(const tcp_evaluator & _tcp_evaluator);
+
+	void connectWorkers();
+	bool sendBatch(worker_connection & worker, size_t batch_index,
+			const T * const * indivs);
+	bool receiveReply(worker_connection & worker, double * fitness);
+	void reportIncompleteReply(const worker_connection & worker);
+	void workerFailed(worker_connection & worker, double * fitness);
+	void batchFailed(size_t batch_index, double * fitness);
+};
+
+/**
+ * IMPLEMENTATION OF METHODS OF CLASS "tcp_evaluator<T>"
+ * =====================================================
+ */
+
+template<typename T>
+tcp_evaluator<T>::tcp_evaluator(const vector<tcp_endpoint> & endpoints)
+{
+	for(const tcp_endpoint & endpoint : endpoints)
+	{
+		worker_connection worker;
+		worker.endpoint = endpoint;
+		workers.push_back(worker);
+	}
+	connectWorkers();
+}
+
+template<typename T>
+tcp_evaluator<T>::~tcp_evaluator()
+{
+	for(worker_connection & worker : workers)
+	{
+		if(worker.socket_fd >= 0)
+		{
+			close(worker.socket_fd);
+			worker.socket_fd = -1;
+		}
+	}
+}
+
+template<typename T>
+void tcp_evaluator<T>::setBatchSize(size_t batch_size)
+{
+	if(batch_size >= 1)
+	{
+		BATCH_SIZE = batch_size;
+	}
+}
+
+template<typename T>
+void tcp_evaluator<T>::setPipelineDepth(size_t pipeline_depth)
+{
+	if(pipeline_depth >= 1)
+	{
+		PIPELINE_DEPTH = pipeline_depth;
+	}
+}
+
+template<typename T>
+void tcp_evaluator<T>::setMaxRetries(size_t max_retries)
+{
+	MAX_RETRIES = max_retries;
+}
+
+template<typename T>
+void tcp_evaluator<T>::setReplyTimeout(int reply_timeout_ms)
+{
+	REPLY_TIMEOUT_MS = reply_timeout_ms;
+}
+
+template<typename T>
+size_t tcp_evaluator<T>::getNumOfLiveWorkers()
+{
+	size_t num_of_live_workers = 0;
+	for(const worker_connection & worker : workers)
+	{
+		if(worker.socket_fd >= 0)
+		{
+			num_of_live_workers++;
+		}
+	}
+	return num_of_live_workers;
+}
+
+/**
+ * connect to each worker that does not have an open connection
+ */
+template<typename T>
+void tcp_evaluator<T>::connectWorkers()
+{
+	for(worker_connection & worker : workers)
+	{
+		if(worker.socket_fd < 0)
+		{
+			worker.socket_fd = tcpConnect(worker.endpoint);
+			if(worker.socket_fd >= 0)
+			{
+				worker.connect_error_reported = false;
+			}
+			else if(!worker.connect_error_reported)
+			{
+				cerr<<"error connecting to worker "<<worker.endpoint.host
+						<<":"<<worker.endpoint.port<<endl;
+				worker.connect_error_reported = true;
+			}
+		}
+	}
+}
+
+/**
+ * keep upto PIPELINE_DEPTH batches sent to each live worker,
+ * and receive replies as they arrive, until each batch is replied or failed
+ */
+template<typename T>
+void tcp_evaluator<T>::evaluate(const T * const * indivs, double * fitness,
+		size_t num_of_indivs)
+{
+	connectWorkers();
+
+	batches.clear();
+	pending_batches.clear();
+	num_of_done_batches = 0;
+	for(size_t begin = 0; begin < num_of_indivs; begin += BATCH_SIZE)
+	{
+		batch a_batch;
+		a_batch.begin = begin;
+		a_batch.end = min(num_of_indivs, begin + BATCH_SIZE);
+		a_batch.num_of_retries = 0;
+		a_batch.batch_id = next_batch_id++;
+		pending_batches.push_back(batches.size());
+		batches.push_back(a_batch);
+	}
+
+	vector<pollfd> poll_fds;
+	vector<worker_connection *> polled_workers;
+	while(num_of_done_batches < batches.size())
+	{
+		// fill pipeline of each live worker
+		for(worker_connection & worker : workers)
+		{
+			while(worker.socket_fd >= 0 && worker.in_flight.size() < PIPELINE_DEPTH
+					&& !pending_batches.empty())
+			{
+				const size_t batch_index = pending_batches.front();
+				pending_batches.pop_front();
+				if(worker.in_flight.empty())
+				{
+					worker.last_progress = chrono::steady_clock::now();
+				}
+				worker.in_flight.push_back(batch_index);
+
+				if(!sendBatch(worker, batch_index, indivs))
+				{
+					workerFailed(worker, fitness);
+				}
+			}
+		}
+
+		poll_fds.clear();
+		polled_workers.clear();
+		for(worker_connection & worker : workers)
+		{
+			if(worker.socket_fd >= 0 && !worker.in_flight.empty())
+			{
+				pollfd poll_fd;
+				poll_fd.fd = worker.socket_fd;
+				poll_fd.events = POLLIN;
+				poll_fd.revents = 0;
+				poll_fds.push_back(poll_fd);
+				polled_workers.push_back(&worker);
+			}
+		}
+
+		// no worker is left to evaluate remaining batches
+		if(poll_fds.empty())
+		{
+			while(!pending_batches.empty())
+			{
+				batchFailed(pending_batches.front(), fitness);
+				pending_batches.pop_front();
+			}
+			break;
+		}
+
+		int num_of_ready = poll(poll_fds.data(), poll_fds.size(), REPLY_TIMEOUT_MS);
+		if(num_of_ready < 0 && errno != EINTR)
+		{
+			cerr<<"error waiting for workers : "<<strerror(errno)<<endl;
+			for(worker_connection * workerP : polled_workers)
+			{
+				workerFailed(*workerP, fitness);
+			}
+			continue;
+		}
+
+		const chrono::steady_clock::time_point now = chrono::steady_clock::now();
+		for(size_t k = 0; k < poll_fds.size(); k++)
+		{
+			worker_connection & worker = *polled_workers[k];
+			if(poll_fds[k].revents != 0)
+			{
+				if(!receiveReply(worker, fitness))
+				{
+					workerFailed(worker, fitness);
+				}
+			}
+			else if(chrono::duration_cast<chrono::milliseconds>(
+					now - worker.last_progress).count() >= REPLY_TIMEOUT_MS)
+			{
+				cerr<<"error worker "<<worker.endpoint.host<<":"<<worker.endpoint.port
+						<<" did not reply in "<<REPLY_TIMEOUT_MS<<" ms"<<endl;
+				workerFailed(worker, fitness);
+			}
+		}
+	}
+}
+
+/**
+ * send a request with individuals of a batch
+ */
+template<typename T>
+bool tcp_evaluator<T>::sendBatch(worker_connection & worker, size_t batch_index,
+		const T * const * indivs)
+{
+	const batch & a_batch = batches[batch_index];
+
+	tcp_message_header header;
+	header.magic = TCP_MESSAGE_MAGIC;
+	header.batch_id = a_batch.batch_id;
+	header.num_of_indivs = a_batch.end - a_batch.begin;
+	header.reserved = 0;
+
+	request.assign(sizeof(header), '\0');
+	for(size_t i = a_batch.begin; i < a_batch.end; i++)
+	{
+		genome_codec<T>::encode(*(*(indivs + i)), request);
+	}
+	header.payload_size = request.size() - sizeof(header);
+	memcpy(&request[0], &header, sizeof(header));
+
+	return tcpSendAll(worker.socket_fd, request.data(), request.size());
+}
+
+/**
+ * receive reply for oldest batch sent to a worker
+ */
+template<typename T>
+bool tcp_evaluator<T>::receiveReply(worker_connection & worker, double * fitness)
+{
+	const size_t batch_index = worker.in_flight.front();
+	const batch & a_batch = batches[batch_index];
+	const size_t num_of_indivs = a_batch.end - a_batch.begin;
+
+	// a worker that stops in the middle of a reply must not block the master
+	const chrono::steady_clock::time_point deadline =
+			chrono::steady_clock::now() + chrono::milliseconds(REPLY_TIMEOUT_MS);
+	tcp_message_header header;
+	if(!tcpReceiveAll(worker.socket_fd, (char *) &header, sizeof(header), REPLY_TIMEOUT_MS))
+	{
+		reportIncompleteReply(worker);
+		return false;
+	}
+
+	if(header.magic != TCP_MESSAGE_MAGIC || header.batch_id != a_batch.batch_id
+			|| header.num_of_indivs != num_of_indivs
+			|| header.payload_size != num_of_indivs*sizeof(double))
+	{
+		cerr<<"error invalid reply from worker "<<worker.endpoint.host
+				<<":"<<worker.endpoint.port<<endl;
+		return false;
+	}
+
+	reply_fitness.resize(num_of_indivs);
+	const long long remaining_ms = chrono::duration_cast<chrono::milliseconds>(
+			deadline - chrono::steady_clock::now()).count();
+	if(!tcpReceiveAll(worker.socket_fd, (char *) reply_fitness.data(), header.payload_size,
+			(int) max(remaining_ms, 0LL)))
+	{
+		reportIncompleteReply(worker);
+		return false;
+	}
+
+	copy(reply_fitness.begin(), reply_fitness.end(), fitness + a_batch.begin);
+	worker.in_flight.pop_front();
+	worker.last_progress = chrono::steady_clock::now();
+	num_of_done_batches++;
+	return true;
+}
+
+/**
+ * report a reply that was not received completely within REPLY_TIMEOUT_MS
+ */
+template<typename T>
+void tcp_evaluator<T>::reportIncompleteReply(const worker_connection & worker)
+{
+	if(errno == ETIMEDOUT)
+	{
+		cerr<<"error worker "<<worker.endpoint.host<<":"<<worker.endpoint.port
+				<<" did not complete its reply in "<<REPLY_TIMEOUT_MS<<" ms"<<endl;
+	}
+}
+
+/**
+ * close connection of a failed worker and retry its outstanding batches
+ */
+template<typename T>
+void tcp_evaluator<T>::workerFailed(worker_connection & worker, double * fitness)
+{
+	cerr<<"error worker "<<worker.endpoint.host<<":"<<worker.endpoint.port
+			<<" failed with "<<worker.in_flight.size()<<" outstanding batch(es)"<<endl;
+
+	if(worker.socket_fd >= 0)
+	{
+		close(worker.socket_fd);
+		worker.socket_fd = -1;
+	}
+
+	// retry in original order, before any other pending batch
+	while(!worker.in_flight.empty())
+	{
+		const size_t batch_index = worker.in_flight.back();
+		worker.in_flight.pop_back();
+
+		batch & a_batch = batches[batch_index];
+		if(a_batch.num_of_retries < MAX_RETRIES)
+		{
+			a_batch.num_of_retries++;
+			num_of_retries++;
+			pending_batches.push_front(batch_index);
+		}
+		else
+		{
+			batchFailed(batch_index, fitness);
+		}
+	}
+}
+
+/**
+ * mark individuals of a batch as not evaluated
+ */
+template<typename T>
+void tcp_evaluator<T>::batchFailed(size_t batch_index, double * fitness)
+{
+	const batch & a_batch = batches[batch_index];
+	for(size_t i = a_batch.begin; i < a_batch.end; i++)
+	{
+		fitness[i] = numeric_limits<double>::quiet_NaN();
+	}
+	num_of_done_batches++;
+}
+}
+
+#endif /* TCP_EVALUATOR_H_ */
@@ -0,0 +1,215 @@
+/*
+ * tcp_protocol.h
+ * Messages and socket helpers shared by TCP evaluator and TCP worker
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef TCP_PROTOCOL_H_
+#define TCP_PROTOCOL_H_
+
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <unistd.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * TCP EVALUATION PROTOCOL
+ * =======================
+ * Each message is a header followed by payload_size bytes of payload.
+ *
+ * request (master -> worker) : header + encoded individuals (see genome_codec)
+ * reply   (worker -> master) : header + one double fitness for each individual
+ *
+ * Reply has same batch id as its request. A worker replies to its requests in order,
+ * so a master can send several requests before reading any reply (pipelining).
+ *
+ */
+const uint32_t TCP_MESSAGE_MAGIC = 0x47414556; // "GAEV"
+
+// default limit of payload of a request accepted by a worker (256 MB)
+const uint64_t TCP_MAX_PAYLOAD_SIZE = 1ULL << 28;
+
+struct tcp_message_header
+{
+	uint32_t magic;
+	uint32_t batch_id;
+	uint32_t num_of_indivs;
+	uint32_t reserved;
+	uint64_t payload_size;
+};
+
+/**
+ * address of a worker process
+ */
+struct tcp_endpoint
+{
+	string host;
+	uint16_t port;
+};
+
+/**
+ * send all bytes, returns false if connection is broken
+ */
+inline bool tcpSendAll(int socket_fd, const char * data, size_t size)
+{
+	while(size > 0)
+	{
+		ssize_t sent = send(socket_fd, data, size, MSG_NOSIGNAL);
+		if(sent < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if(sent <= 0)
+		{
+			return false;
+		}
+		data += sent;
+		size -= sent;
+	}
+	return true;
+}
+
+/**
+ * receive exactly size bytes, returns false if connection is closed or broken.
+ * With timeout_ms >= 0, each chunk is waited for only until timeout_ms after the call
+ * (errno is ETIMEDOUT when it returns false for this reason).
+ */
+inline bool tcpReceiveAll(int socket_fd, char * data, size_t size, int timeout_ms = -1)
+{
+	const chrono::steady_clock::time_point deadline =
+			chrono::steady_clock::now() + chrono::milliseconds(max(timeout_ms, 0));
+	while(size > 0)
+	{
+		if(timeout_ms >= 0)
+		{
+			const long long remaining_ms = chrono::duration_cast<chrono::milliseconds>(
+					deadline - chrono::steady_clock::now()).count();
+			pollfd poll_fd;
+			poll_fd.fd = socket_fd;
+			poll_fd.events = POLLIN;
+			poll_fd.revents = 0;
+			int num_of_ready = poll(&poll_fd, 1, (int) max(remaining_ms, 0LL));
+			if(num_of_ready < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			if(num_of_ready == 0)
+			{
+				errno = ETIMEDOUT;
+				return false;
+			}
+			if(num_of_ready < 0)
+			{
+				return false;
+			}
+		}
+
+		ssize_t received = recv(socket_fd, data, size, 0);
+		if(received < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if(received <= 0)
+		{
+			return false;
+		}
+		data += received;
+		size -= received;
+	}
+	return true;
+}
+
+/**
+ * open a listening socket on all interfaces (port 0 selects any free port),
+ * returns socket or -1 on error and sets bound_port to the listening port
+ */
+inline int tcpListen(uint16_t port, uint16_t & bound_port)
+{
+	int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+	if(listen_fd < 0)
+	{
+		return -1;
+	}
+
+	int reuse = 1;
+	setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+	sockaddr_in address;
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_ANY);
+	address.sin_port = htons(port);
+
+	socklen_t address_length = sizeof(address);
+	if(bind(listen_fd, (sockaddr *) &address, sizeof(address)) < 0
+			|| listen(listen_fd, 16) < 0
+			|| getsockname(listen_fd, (sockaddr *) &address, &address_length) < 0)
+	{
+		close(listen_fd);
+		return -1;
+	}
+
+	bound_port = ntohs(address.sin_port);
+	return listen_fd;
+}
+
+/**
+ * connect to a host and port, returns socket or -1 on error
+ */
+inline int tcpConnect(const tcp_endpoint & endpoint)
+{
+	addrinfo hints, * addresses = NULL;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+
+	const string port = to_string(endpoint.port);
+	if(getaddrinfo(endpoint.host.c_str(), port.c_str(), &hints, &addresses) != 0)
+	{
+		return -1;
+	}
+
+	int socket_fd = -1;
+	for(addrinfo * address = addresses; address != NULL; address = address->ai_next)
+	{
+		socket_fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+		if(socket_fd < 0)
+		{
+			continue;
+		}
+		if(connect(socket_fd, address->ai_addr, address->ai_addrlen) == 0)
+		{
+			break;
+		}
+		close(socket_fd);
+		socket_fd = -1;
+	}
+	freeaddrinfo(addresses);
+
+	if(socket_fd >= 0)
+	{
+		// small requests and replies should not wait for more data
+		int no_delay = 1;
+		setsockopt(socket_fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+	}
+	return socket_fd;
+}
+}
+
+#endif /* TCP_PROTOCOL_H_ */
@@ -0,0 +1,142 @@
+/*
+ * tcp_worker.h
+ * Worker process side of fitness evaluation over TCP
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef TCP_WORKER_H_
+#define TCP_WORKER_H_
+
+#include <iostream>
+#include <functional>
+#include <vector>
+#include "eval/tcp_protocol.h"
+#include "util/genome_codec.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * TCP WORKER
+ * ==========
+ * Accepts connections from a master (tcp_evaluator) on a listening socket,
+ * and replies to each request with fitness of its individuals.
+ * One connection is served at a time, until master closes it.
+ *
+ * listen_fd - listening socket (see tcpListen)
+ * fitness_function - fitness of an individual
+ * max_connections - return after serving these many connections (0 means never return)
+ * max_payload_size - larger requests are rejected (and their connection is closed)
+ *
+ */
+template<typename T>
+void runTcpWorker(int listen_fd, const function<double(const T &)> & fitness_function,
+		size_t max_connections = 0, uint64_t max_payload_size = TCP_MAX_PAYLOAD_SIZE);
+
+/**
+ * serve requests of one connection until it is closed,
+ * returns false if connection was broken or a request was invalid
+ */
+template<typename T>
+bool serveTcpConnection(int socket_fd, const function<double(const T &)> & fitness_function,
+		uint64_t max_payload_size = TCP_MAX_PAYLOAD_SIZE);
+
+
+/**
+ * IMPLEMENTATION OF TCP WORKER
+ * ============================
+ */
+
+template<typename T>
+void runTcpWorker(int listen_fd, const function<double(const T &)> & fitness_function,
+		size_t max_connections, uint64_t max_payload_size)
+{
+	for(size_t num_of_connections = 0;
+			max_connections == 0 || num_of_connections < max_connections;)
+	{
+		int socket_fd = accept(listen_fd, NULL, NULL);
+		if(socket_fd < 0)
+		{
+			if(errno == EINTR)
+			{
+				continue;
+			}
+			cerr<<"error accepting connection : "<<strerror(errno)<<endl;
+			return;
+		}
+
+		int no_delay = 1;
+		setsockopt(socket_fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+		if(!serveTcpConnection<T>(socket_fd, fitness_function, max_payload_size))
+		{
+			cerr<<"error serving connection, waiting for next connection"<<endl;
+		}
+		close(socket_fd);
+		num_of_connections++;
+	}
+}
+
+template<typename T>
+bool serveTcpConnection(int socket_fd, const function<double(const T &)> & fitness_function,
+		uint64_t max_payload_size)
+{
+	tcp_message_header header;
+	string payload;
+	vector<T> indivs;
+	vector<double> fitness;
+
+	// read next request (connection closed by master ends this loop)
+	while(tcpReceiveAll(socket_fd, (char *) &header, sizeof(header)))
+	{
+		if(header.magic != TCP_MESSAGE_MAGIC)
+		{
+			cerr<<"error invalid request header"<<endl;
+			return false;
+		}
+
+		// sizes are checked before allocating, each individual takes at least one byte
+		if(header.payload_size > max_payload_size || header.num_of_indivs > header.payload_size)
+		{
+			cerr<<"error invalid size of request "<<header.batch_id<<" : "
+					<<header.num_of_indivs<<" individual(s) in "<<header.payload_size<<" bytes"<<endl;
+			return false;
+		}
+
+		payload.resize(header.payload_size);
+		if(!tcpReceiveAll(socket_fd, &payload[0], payload.size()))
+		{
+			return false;
+		}
+
+		indivs.resize(header.num_of_indivs);
+		fitness.resize(header.num_of_indivs);
+		const char * data = payload.data();
+		const char * end = data + payload.size();
+		for(uint32_t i = 0; i < header.num_of_indivs; i++)
+		{
+			if(!genome_codec<T>::decode(data, end, indivs[i]))
+			{
+				cerr<<"error invalid individual in request "<<header.batch_id<<endl;
+				return false;
+			}
+			fitness[i] = fitness_function(indivs[i]);
+		}
+
+		tcp_message_header reply_header = header;
+		reply_header.payload_size = fitness.size()*sizeof(double);
+		if(!tcpSendAll(socket_fd, (const char *) &reply_header, sizeof(reply_header))
+				|| !tcpSendAll(socket_fd, (const char *) fitness.data(), reply_header.payload_size))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+}
+
+#endif /* TCP_WORKER_H_ */
@@ -13,13 +13,41 @@
 #include <iostream>
 #include <map>
 #include <vector>
+#include <algorithm>
 #include <random>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <chrono>
+#include <cmath>
 #include <float.h>
+#include "util/random_engines.h"
+#include "eval/fitness_evaluator.h"
+#include "eval/genome_change.h"
+#include "util/thread_pool.h"
+#include "util/genome_hash_set.h"
+#include "util/arena.h"
+#include "util/telemetry_ring.h"
+#include "util/cpu_affinity.h"
+#include "stopping_criteria.h"
+#include "diversity.h"
+#include "surrogate.h"
 
 using namespace std;
 
 namespace ga
 {
+/**
+ * mutation probability and step size carried by an individual (self-adaptive mutation)
+ */
+struct mutation_strategy
+{
+	double mutation_prob = 0.1;
+	double step_size = 0.1;
+};
 
 /**
  * SIMPLE GENETIC ALGORITHM (simple_ga)
@@ -27,6 +55,14 @@ namespace ga
  * It is a simple Genetic Algorithm (GA) written as a generic class with type parameter T.
  * Type parameter T is the type used to represent an individual that GA would evolve.
  * In most cases a vector of int would represent an individual and T would be "vector<int>".
+ * Type parameter RandomEngine is the random number engine used by GA (mt19937 by default).
+ * Derived classes should use the same engine type (random_engine_type) and create their
+ * engines as independent streams (nextRandomStream), so that one seed (setSeed) defines a run.
+ * Smaller and faster engines are in "util/random_engines.h" (xoshiro256ss, pcg64, splitmix64).
+ * Type parameter Allocator allocates individuals of population (std::allocator by default),
+ * individuals of a generation are allocated together as one block.
+ * Temporary values of operators (e.g. in crossOver) can be taken from scratch_arena, which
+ * is reset after each generation (see "util/arena.h").
  * Note :- Some methods in GA are specific to type parameter T and are left
  * as pure virtual methods to be implemented when T is defined. For example, generating
  * a random individual of type T cannot be implemented without knowing T.
@@ -46,9 +82,20 @@ namespace ga
  *
  * ELITISM - is true by default. Random selection strategy is used for elite replacement.
  *
- * STOPPING CRITERION - when GA has run for set maximum number of generations.
- * This criterion can be overriden in a derived class. Examples of other criteria are :
- * Elapsed time or average fitness compared to best fitness.
+ * ASYNCHRONOUS EVALUATION - is off by default. When it is on, fitness is calculated by a
+ * pool of threads and GA does not wait for a whole generation (steady state GA) :
+ * an offspring is bred for each free thread and submitted for evaluation, and each
+ * evaluated offspring replaces the worse of two randomly selected individuals as soon as
+ * it is ready. A generation is counted for each POPULATION_SIZE evaluations.
+ * An evaluation that takes longer than the optional deadline gets a penalty fitness.
+ * getFitness must be safe to call from several threads at once in this mode.
+ *
+ * STOPPING CRITERION - when GA has run for set maximum number of generations
+ * (a negative maximum means no limit), or when optional stopping criterion says stop.
+ * Stopping criteria can be combined (see "stopping_criteria.h"), for example :
+ * no improvement for G generations, elapsed time, number of evaluations, target fitness or
+ * average fitness compared to best fitness.
+ * shouldStop() can also be overriden in a derived class.
  *
  */
 
@@ -62,21 +109,217 @@ namespace ga
  * 4. T crossOver(const crossoverParents & crossoverParents) - create an offspring from two parents
  * 5. void mutate(T & indiv) - mutate an individual
  *
- * *** Additionally, method that can optionally be overridden ***
+ * *** Additionally, methods that can optionally be overridden ***
  * 6. bool shouldStop() - stopping criteria for the GA
+ * 7. bool generateRandomIndiv(T & indiv, random_engine_type & random_engine) - generate a random
+ * individual using only the given random engine (enables parallel initialization)
+ * 8. void initRandomEngines() - (re)create random engines of derived class from nextRandomStream()
+ * 9. void crossOverInPlace(const crossoverParents & crossoverParents, T & offspring) - create an
+ * offspring in an existing individual (e.g. reusing memory of its vector)
+ * 10. double localSearch(T & indiv, double fitness, unsigned budget) - improve an individual
+ * with a local search (see setLocalSearch)
+ * 11. bool crossOverWithEngine(const crossoverParents & crossoverParents, T & offspring,
+ * random_engine_type & random_engine) - thread safe crossover (for large population mode)
+ * 12. bool mutateWithEngine(T & indiv, random_engine_type & random_engine) - thread safe
+ * mutation (for large population mode)
+ * 13. bool getBatchFitness(const T * const * indivs, double * fitness, size_t num_of_indivs) -
+ * fitness of several individuals at once (e.g. with SIMD), same values as getFitness
+ * 14. bool getFitnessDelta(const T & parent, double parent_fitness, const T & offspring,
+ * const genome_change & change, double & fitness) - fitness of an offspring from fitness
+ * of its base parent and its changed alleles (see setDeltaEvaluation)
  *
  */
-template <typename T>
+template <typename T, typename RandomEngine = mt19937, typename Allocator = allocator<T>>
 class simple_ga
 {
+	static_assert(is_same<typename Allocator::value_type, T>::value,
+			"value type of Allocator must be type of individual T");
+
 public :
+	typedef RandomEngine random_engine_type;
+	typedef Allocator allocator_type;
+
+	/**
+	 * optional method for setting seed of all random engines
+	 * (random engines of GA and of derived class)
+	 */
+	void setSeed(uint64_t seed);
+
 	/**
 	 * optional method for changing default parameter settings
 	 */
-	void setParameters(int population_size, int max_num_generations,
+	void setParameters(long long population_size, long long max_num_generations,
 			double crossover_prob, double mutation_prob,
 			double allele_mutation_prob, bool elitism);
 
+	/**
+	 * optional method for setting number of threads used to generate
+	 * the initial random population (default is 1 i.e. no extra thread).
+	 * Threads are used only if generateRandomIndiv(T &, random_engine_type &) is overridden.
+	 */
+	void setInitializationThreads(unsigned num_threads);
+
+	/**
+	 * optional method for calculating fitness with an evaluation backend
+	 * (e.g. worker processes) instead of calling getFitness in this process.
+	 * GA does not own the evaluator, NULL resets to getFitness.
+	 */
+	void setFitnessEvaluator(fitness_evaluator<T> * evaluator)
+	{
+		fitness_evaluatorP = evaluator;
+	}
+
+	/**
+	 * optional method for switching on asynchronous evaluation with given number
+	 * of evaluation threads (0 switches it off and GA waits for each generation)
+	 */
+	void setAsyncEvaluation(unsigned num_threads);
+
+	/**
+	 * optional method for setting a deadline for each evaluation in asynchronous mode,
+	 * an individual whose evaluation does not finish in deadline_ms gets penalty_fitness
+	 * (deadline_ms <= 0 means no deadline). Deadline of an evaluation starts when an
+	 * evaluation thread starts it, and GA submits an evaluation only for a free thread.
+	 */
+	void setEvaluationDeadline(int deadline_ms, double penalty_fitness);
+
+	/**
+	 * optional method for setting a stopping criterion, it is checked after each
+	 * generation in addition to maximum number of generations (NULL removes it)
+	 */
+	void setStoppingCriterion(const stopping_criterionP & criterion)
+	{
+		stopping_criterion_ptr = criterion;
+	}
+
+	/**
+	 * optional method for tracking diversity of population after each generation
+	 * (unique individuals, mean distance and allele entropy, see "diversity.h").
+	 * Mean distance is estimated from num_of_sample_pairs random pairs
+	 * (0 means as many pairs as population size).
+	 */
+	void setDiversityTracking(bool track_diversity, size_t num_of_sample_pairs = 0);
+
+	/**
+	 * optional method for eliminating duplicate offspring in each generation
+	 * (needs genome_traits for type of individual, see "util/genome_traits.h").
+	 * An offspring equal to a parent or to an earlier offspring is not evaluated,
+	 * it gets fitness of that individual (except a parent after Baldwinian local search,
+	 * see setLocalSearch). With max_rebreed_attempts > 0 a duplicate is first bred again
+	 * (with mutation) up to that many times to keep diversity.
+	 * It is used in generational GA only (not in asynchronous evaluation).
+	 */
+	void setDuplicateElimination(bool eliminate_duplicates,
+			unsigned max_rebreed_attempts = 0);
+
+	/**
+	 * optional method for switching on memetic mode : after each generation
+	 * localSearch(indiv, fitness, budget) is run on num_of_elites best individuals.
+	 * Lamarckian write-back keeps improved individual in population, Baldwinian
+	 * write-back keeps only its improved fitness (individual is not changed).
+	 * num_of_elites 0 switches it off. It is used in generational GA only.
+	 */
+	void setLocalSearch(size_t num_of_elites, unsigned budget, bool lamarckian = true);
+
+	/**
+	 * optional method for switching on delta evaluation : crossover and mutation note
+	 * alleles they change (recordChangeBase, recordChange), and fitness of an offspring is
+	 * calculated by getFitnessDelta from fitness of its base parent and these changes.
+	 * Every full_evaluation_interval-th generation is fully evaluated (with getFitness),
+	 * so that errors (e.g. of floating point sums) do not add up over generations.
+	 * All operators of derived class that change an offspring must record their changes.
+	 * full_evaluation_interval < 2 switches it off. It is used in generational GA only.
+	 */
+	void setDeltaEvaluation(unsigned full_evaluation_interval);
+
+	/**
+	 * optional method for switching off lazy evaluation. By default an offspring that
+	 * is an unchanged copy of its parent (no crossover and no mutation) keeps fitness
+	 * of its parent instead of being evaluated again. It should be switched off if
+	 * fitness of the same individual can change (e.g. a noisy or time dependent fitness).
+	 */
+	void setLazyEvaluation(bool lazy_evaluation)
+	{
+		LAZY_EVALUATION = lazy_evaluation;
+	}
+
+	/**
+	 * optional method for switching on surrogate pre-screening of offspring : a surrogate
+	 * model (see "surrogate.h", e.g. k-NN or RBF over evaluated individuals) predicts
+	 * fitness of offspring that would be evaluated, and only evaluated_fraction of them
+	 * with best predicted fitness are evaluated. Other offspring are replaced by a copy of
+	 * their parent (at same index, with its fitness), so that population has only true
+	 * fitness values. Offspring already in archive of model keep their known fitness
+	 * (with lazy evaluation). Each evaluated individual is added to the model.
+	 * At least min_evaluated_fraction of population size offspring are evaluated in
+	 * each generation (if so many are not in archive), since with too few new
+	 * individuals population collapses into copies of its best individuals.
+	 * Offspring found in archive are not counted in num_of_evaluations, so a converged
+	 * population makes few evaluations per generation and evaluation_budget_criterion may
+	 * never stop it : combine it with a maximum number of generations, stagnation_criterion
+	 * or time_budget_criterion.
+	 * GA does not own the model, NULL switches it off. It is used in generational GA only.
+	 */
+	void setSurrogate(surrogate_model<T> * model, double evaluated_fraction = 0.5,
+			double min_evaluated_fraction = 0.1);
+
+	/**
+	 * optional method for switching on self-adaptive mutation : each individual carries
+	 * its own mutation probability and step size (mutation_strategy). An offspring gets
+	 * strategy of its parent (mean probability and geometric mean step size of both parents
+	 * after crossover), which is changed before the offspring is mutated with it :
+	 * step size - multiplied by exp(learning_rate*N(0, 1)) (log-normal, as in evolution
+	 * strategies), probability - its odds p/(1 - p) multiplied the same way (stays in (0, 1)).
+	 * So strategies that breed fit offspring spread with them. Derived classes read step
+	 * size of the individual being mutated with getMutationStepSize().
+	 * Initial strategy is MUTATION_PROBABILITY and initial_step_size (which is also the
+	 * fixed step size when it is switched off). It is used in generational GA only.
+	 */
+	void setSelfAdaptiveMutation(bool self_adaptive, double initial_step_size = 0.1,
+			double learning_rate = 0.3);
+
+	/**
+	 * strategy of each individual of population (self-adaptive mutation)
+	 */
+	const vector<mutation_strategy> & getMutationStrategies()
+	{
+		return population_strategies;
+	}
+
+	/**
+	 * optional method for switching on large population mode : population is divided in
+	 * num_of_chunks chunks, each evolved by its own thread (pinned to a CPU), with
+	 * selection within its chunk. After every mixing_interval generations best
+	 * migration_rate of each chunk replace random individuals of next chunk (ring).
+	 * Individuals of a chunk are first written by its thread, so their memory is
+	 * on NUMA node of that thread. It needs generateRandomIndiv, crossOverWithEngine
+	 * and mutateWithEngine of derived class (otherwise generational GA is run).
+	 * Duplicate elimination, memetic mode, async evaluation and fitness evaluator
+	 * are not used in this mode. num_of_chunks 0 switches it off.
+	 */
+	void setLargePopulationMode(unsigned num_of_chunks, unsigned mixing_interval = 10,
+			double migration_rate = 0.01);
+
+	/**
+	 * optional method for writing statistics of each generation to a memory mapped
+	 * ring buffer file (see "util/telemetry_ring.h"), for watching a run from another
+	 * process. GA does not own the writer, NULL switches it off.
+	 */
+	void setTelemetry(telemetry_writer * writer)
+	{
+		telemetry_writerP = writer;
+	}
+
+	/**
+	 * optional method for switching off display of progress during a run
+	 * (e.g. when many GAs are run together, see "batch_runner.h"), including
+	 * notes of generations whose fitness values are all equal. Errors are displayed.
+	 */
+	void setVerbose(bool verbose)
+	{
+		VERBOSE = verbose;
+	}
+
 	/**
 	 * displays current parameter settings
 	 */
@@ -85,25 +328,42 @@ public :
 	/**
 	 * run genetic algorithm
 	 */
-	void run();
+	virtual void run();
 
 	/**
 	 * displays results after GA run
 	 */
-	void displayResults();
+	virtual void displayResults();
 
 	/**
 	 * returns current number of generations
 	 */
-	int getNumOfGenerations()
+	long long getNumOfGenerations()
 	{
 		return num_of_generations;
 	}
 
+	/**
+	 * returns current number of fitness calculations
+	 */
+	unsigned long long getNumOfEvaluations()
+	{
+		return statistics.num_of_evaluations;
+	}
+
+	/**
+	 * returns statistics of current GA run
+	 */
+	const ga_statistics & getStatistics()
+	{
+		return statistics;
+	}
+
 	/**
 	 * returns the best individual known so far
+	 * (reference is valid until next run of GA)
 	 */
-	T getBestSolution()
+	const T & getBestSolution()
 	{
 		return best_individual;
 	}
@@ -118,7 +378,7 @@ public :
 
 protected:
 	size_t POPULATION_SIZE = 100;
-	int MAX_NUM_OF_GENERATIONS = 1000;
+	long long MAX_NUM_OF_GENERATIONS = 1000;
 
 	double CROSSOVER_PROBABILITY = 0.8;
 	double MUTATION_PROBABILITY = 0.1;
@@ -126,6 +386,38 @@ protected:
 
 	bool ELITISM = true;
 
+	unsigned INITIALIZATION_THREADS = 1;
+
+	unsigned ASYNC_EVALUATION_THREADS = 0;
+	int EVALUATION_DEADLINE_MS = 0;
+	double PENALTY_FITNESS = 0;
+
+	bool TRACK_DIVERSITY = false;
+	size_t DIVERSITY_SAMPLE_PAIRS = 0;
+
+	bool VERBOSE = true;
+
+	unsigned NUM_OF_CHUNKS = 0;
+	unsigned MIXING_INTERVAL = 10;
+	double MIGRATION_RATE = 0.01;
+
+	bool ELIMINATE_DUPLICATES = false;
+	unsigned MAX_REBREED_ATTEMPTS = 0;
+
+	size_t LOCAL_SEARCH_ELITES = 0;
+	unsigned LOCAL_SEARCH_BUDGET = 0;
+	bool LAMARCKIAN = true;
+
+	unsigned FULL_EVALUATION_INTERVAL = 0;
+	bool LAZY_EVALUATION = true;
+
+	bool SELF_ADAPTIVE_MUTATION = false;
+	double MUTATION_STEP_SIZE = 0.1;
+	double MUTATION_LEARNING_RATE = 0.3;
+
+	double SURROGATE_EVALUATED_FRACTION = 1;
+	double SURROGATE_MIN_EVALUATED_FRACTION = 0;
+
 	struct crossoverParents
 	{
 		const T * parent1 = NULL;
@@ -134,20 +426,23 @@ protected:
 
 	T **population = NULL;
 
+	// memory for temporary values of a generation, reset after each generation
+	generation_arena scratch_arena;
+
 	// typedef for mapping individual T to its fitness
 	typedef map<const T *, double> fitness_map_type;
 
 	fitness_map_type * fitness_mapP = NULL;
 	fitness_map_type * cumulative_mapP = NULL;
 
-	int num_of_generations = -1;
+	long long num_of_generations = -1;
 
 	// best known so far
 	T best_individual;
 	double best_fitness = - DBL_MAX;
 
-	// current generation best fitness
-	T gen_best_individual;
+	// current generation best fitness, and index of its individual in population
+	size_t gen_best_index = 0;
 	double gen_best_fitness = - DBL_MAX;
 
 	// current generation minimum fitness
@@ -155,10 +450,36 @@ protected:
 
 	double avg_fitness = 0;
 	double fitness_sum = 0;
+	// sum of squares of fitness values (for variance of fitness)
+	double fitness_square_sum = 0;
+
+	// statistics of this run (updated after each generation)
+	ga_statistics statistics;
+	stopping_criterionP stopping_criterion_ptr;
 
 	void initializeRandomPopulation();
-	void copyNextGeneration(const T * const * const next_genP);
-	void updateCurrentGenMinMaxFitness(const T * const indivP, const double t_fitness);
+	void resetStatistics();
+	void updateStatistics();
+	void updateDiversityStatistics();
+	void displayGenerationProgress();
+	void writeTelemetry();
+	void generateRandomPopulation();
+	void evaluatePopulation(const T * const * indivs, double * fitness,
+			size_t num_of_indivs);
+	void runAsync();
+	void replaceIndividual(const T & indiv, const double t_fitness);
+	void copyNextGeneration(T * const * const next_genP);
+	// fitness of a parent is not its own after Baldwinian local search
+	bool isParentFitnessExact() const
+	{
+		return LOCAL_SEARCH_ELITES == 0 || LAMARCKIAN;
+	}
+	void resetDuplicateSet();
+	void eliminateDuplicate(T * const offspringP, size_t offspring_index);
+	void evaluateOffspring(T * const * const next_genP);
+	void applyLocalSearch();
+	void updateCurrentGenMinMaxFitness(size_t index, const double t_fitness);
+	void findCurrentGenMinMaxFitness();
 	bool resetCumulativeMap();
 
 	crossoverParents selectCrossOverParents();
@@ -166,7 +487,17 @@ protected:
 	T * rouletteWheelSelection(const T * const already_selectedP);
 	T * selectSimilarFit(const T * const indivP);
 
-	void tryMutation(T & indiv);
+	bool tryMutation(T & indiv);
+
+	/**
+	 * step size for mutate of derived class (e.g. as a fraction of range of a variable) :
+	 * step size of the individual being mutated with self-adaptive mutation,
+	 * otherwise MUTATION_STEP_SIZE
+	 */
+	double getMutationStepSize()
+	{
+		return mutating_strategyP != NULL ? mutating_strategyP->step_size : MUTATION_STEP_SIZE;
+	}
 
 	/**
 	 * defines the stopping criteria for genetic algorithm.
@@ -174,7 +505,8 @@ protected:
 	 */
 	virtual bool shouldStop()
 	{
-		return num_of_generations >= MAX_NUM_OF_GENERATIONS;
+		return (MAX_NUM_OF_GENERATIONS >= 0 && num_of_generations >= MAX_NUM_OF_GENERATIONS)
+			|| (stopping_criterion_ptr && stopping_criterion_ptr->shouldStop(statistics));
 	}
 
 	/**
@@ -192,6 +524,112 @@ protected:
 	// mutation operation on individual of type T
 	virtual void mutate(T & indiv) = 0;
 
+	/**
+	 * --- OPTIONAL METHODS TO OVERRIDE IN DERIVED CLASS ---
+	 * -----------------------------------------------------
+	 */
+	// generate a random individual of type T using only the given random engine.
+	// It may be called from several threads at once, each with its own engine,
+	// so it must not change any shared state. Returns false if not supported.
+	virtual bool generateRandomIndiv(T & indiv, random_engine_type & random_engine)
+	{
+		return false;
+	}
+
+	// crossover operation that writes offspring into an existing individual.
+	// GA breeds with this method, override it to avoid creating a new T for each offspring.
+	virtual void crossOverInPlace(const crossoverParents & crossover_parents, T & offspring)
+	{
+		offspring = crossOver(crossover_parents);
+	}
+
+	// crossover and mutation using only the given random engine (for large population
+	// mode). They may be called from several threads at once, each with its own engine,
+	// so they must not change any shared state (threadScratchArena() can be used for
+	// temporary values). Return false if not supported.
+	virtual bool crossOverWithEngine(const crossoverParents & crossover_parents, T & offspring,
+			random_engine_type & random_engine)
+	{
+		return false;
+	}
+	virtual bool mutateWithEngine(T & indiv, random_engine_type & random_engine)
+	{
+		return false;
+	}
+
+	// fitness of offspring from fitness of its base parent (parent_fitness) and alleles
+	// noted in change (delta evaluation). Return false if it is not supported (for this
+	// change), then offspring is evaluated with getFitness.
+	virtual bool getFitnessDelta(const T & parent, double parent_fitness, const T & offspring,
+			const genome_change & change, double & fitness)
+	{
+		return false;
+	}
+
+	/**
+	 * for operators with delta evaluation : note that offspring being bred is parent
+	 * (e.g. a crossover parent) with recorded changes, note position of a changed allele,
+	 * or note that changes can not be listed (offspring is then fully evaluated).
+	 * They do nothing when changes are not being recorded.
+	 */
+	void recordChangeBase(const T & parent);
+	bool isRecordingChanges()
+	{
+		return recording_changeP != NULL;
+	}
+	void recordChange(size_t position)
+	{
+		if(recording_changeP != NULL)
+		{
+			recording_changeP->positions.push_back(position);
+		}
+	}
+	void recordIncompleteChange()
+	{
+		if(recording_changeP != NULL)
+		{
+			recording_changeP->is_complete = false;
+		}
+	}
+
+	// local search for memetic mode : improve indiv (whose fitness is given) with
+	// at most budget steps and return its new fitness. Fitness calculations done here
+	// should be added to statistics.num_of_evaluations. By default nothing is changed.
+	// With Baldwinian write-back given fitness is the stored one, which can be an
+	// improved fitness of an earlier search and not fitness of indiv (see LAMARCKIAN).
+	virtual double localSearch(T & indiv, double fitness, unsigned budget)
+	{
+		return fitness;
+	}
+	// create random engines of derived class from nextRandomStream().
+	// It is called by setSeed, and should also be called by constructor of derived class.
+	virtual void initRandomEngines() { }
+
+	// fitness of num_of_indivs individuals at once (e.g. several individuals in SIMD
+	// lanes), values must be the same as getFitness. Used for a generation when there is
+	// no evaluation backend. Return false if not supported.
+	virtual bool getBatchFitness(const T * const * indivs, double * fitness,
+			size_t num_of_indivs)
+	{
+		return false;
+	}
+
+	/**
+	 * returns a random engine for an independent stream of random numbers
+	 * (next stream of GA's seed)
+	 */
+	random_engine_type nextRandomStream();
+
+	/**
+	 * scratch arena of calling thread, for temporary values of operators that may run
+	 * in several threads (reset by each thread of large population mode after a generation)
+	 */
+	static generation_arena & threadScratchArena()
+	{
+		static thread_local generation_arena thread_arena;
+		return thread_arena;
+	}
+
 	// destructor for simple ga
 	virtual ~simple_ga()
 	{
@@ -208,14 +646,8 @@ protected:
 
 		if(population != NULL)
 		{
-			for(size_t i = 0 ; i < POPULATION_SIZE; i++)
-			{
-				if(*(population + i)  != NULL)
-				{
-					delete *(population + i);
-					*(population + i) = NULL;
-				}
-			}
+			deallocateIndivs(population_storage, population_capacity);
+			population_storage = NULL;
 
 			delete [ ] population;
 			population = NULL;
@@ -223,7 +655,17 @@ protected:
 	}
 
 	// constructor for simple ga
-	simple_ga() { }
+	simple_ga()
+	{
+		initBaseRandomEngines(DEFAULT_SEED);
+	}
+
+	// constructor for simple ga with an allocator of individuals
+	explicit simple_ga(const Allocator & genome_allocator) :
+		genome_allocator(genome_allocator)
+	{
+		initBaseRandomEngines(DEFAULT_SEED);
+	}
 
 private:
 	// make class non-copyable for now since its internal state
@@ -233,31 +675,183 @@ private:
 	simple_ga(const simple_ga & _simple_ga);
 	simple_ga & operator=(const simple_ga & _simple_ga);
 
+	static constexpr uint64_t DEFAULT_SEED = 5489;
+
+	// backend for fitness evaluation (NULL if getFitness is called directly)
+	fitness_evaluator<T> * fitness_evaluatorP = NULL;
+	telemetry_writer * telemetry_writerP = NULL;
+	// fitness values of a generation, before they are stored in fitness map
+	vector<double> generation_fitness;
+
+	// indices of population sorted by fitness, and an individual for
+	// Baldwinian local search (for memetic mode)
+	vector<size_t> local_search_order;
+	T local_search_indiv;
+
+	// parents and offspring of current generation (for eliminating duplicates)
+	genome_hash_set<T> duplicate_set;
+	// for each offspring, index of earlier equal offspring, or NOT_DUPLICATE,
+	// or PARENT_DUPLICATE (fitness of parent is then in generation_fitness)
+	vector<long long> duplicate_sources;
+	enum : long long { NOT_DUPLICATE = -2, PARENT_DUPLICATE = -1 };
+
+	// allocator of individuals, and block of individuals of population
+	Allocator genome_allocator;
+	T * population_storage = NULL;
+	size_t population_capacity = 0;
+
+	T * allocateIndivs(size_t num_of_indivs);
+	void deallocateIndivs(T * indivs, size_t num_of_indivs);
+
+	/**
+	 * a part of population evolved by one thread in large population mode
+	 * (its vectors are allocated by its thread)
+	 */
+	struct population_chunk
+	{
+		size_t begin = 0;
+		size_t end = 0;
+		random_engine_type random_engine;
+
+		// fitness and cumulative relative fitness of individuals of chunk
+		vector<double> fitness;
+		vector<double> next_fitness;
+		vector<double> cumulative_fitness;
+
+		size_t best_index = 0;
+		double best_fitness = - DBL_MAX;
+		double min_fitness = DBL_MAX;
+		double fitness_sum = 0;
+		double fitness_square_sum = 0;
+
+		// best individuals of chunk that migrate to next chunk
+		vector<T> emigrants;
+		vector<double> emigrant_fitness;
+	};
+
+	enum chunk_phase { CHUNK_INIT, CHUNK_GENERATION, CHUNK_EMIGRATE, CHUNK_IMMIGRATE, CHUNK_STOP };
+
+	vector<population_chunk> chunks;
+	T * next_gen_chunk_storage = NULL;
+	// threads of chunks start a phase when phase number changes
+	mutex chunk_mutex;
+	condition_variable chunk_phase_started;
+	condition_variable chunk_phase_finished;
+	unsigned long long chunk_phase_number = 0;
+	chunk_phase current_chunk_phase = CHUNK_INIT;
+	size_t num_of_running_chunks = 0;
+
+	bool runLargePopulation();
+	void runChunkPhase(chunk_phase phase);
+	void runChunkThread(size_t c);
+	void initChunk(population_chunk & chunk);
+	void breedChunk(population_chunk & chunk);
+	void selectEmigrants(population_chunk & chunk);
+	void insertImmigrants(population_chunk & chunk, const population_chunk & source_chunk);
+	void updateChunkStatistics(population_chunk & chunk);
+	size_t selectChunkParent(population_chunk & chunk, size_t already_selected);
+	// offspring to evaluate, their indices and their fitness
+	vector<const T *> unique_indivs;
+	vector<size_t> unique_indices;
+	vector<double> unique_fitness;
+
+	// dirty flag of each offspring (1 if it is not an unchanged copy of its parent)
+	vector<char> dirty_offspring;
+
+	// changes of each offspring (for delta evaluation), and change being recorded
+	vector<genome_change> offspring_changes;
+	genome_change * recording_changeP = NULL;
+	bool is_delta_generation = false;
+
+	void beginChangeRecord(size_t offspring_index, long long base_parent_index);
+	long long getStorageIndex(const T * indivP);
+
+	// model for pre-screening offspring (NULL if off), predicted fitness of offspring
+	// to evaluate, their order by prediction, and offspring replaced by their parent
+	surrogate_model<T> * surrogate_modelP = NULL;
+	vector<double> surrogate_predictions;
+	vector<size_t> surrogate_order;
+	vector<char> surrogate_rejected;
+
+	void screenWithSurrogate(T * const * const next_genP);
+	void revertToParent(size_t offspring_index, T * const * const next_genP);
+	void updateSurrogate(const T * const * indivs, const double * fitness,
+			size_t num_of_indivs);
+
+	// strategies of population and next generation (at same indices as individuals),
+	// and strategy of offspring being mutated (for self-adaptive mutation)
+	vector<mutation_strategy> population_strategies;
+	vector<mutation_strategy> next_gen_strategies;
+	const mutation_strategy * mutating_strategyP = NULL;
+
+	void initStrategies();
+	void breedStrategy(size_t offspring_index, const crossoverParents * crossover_parentsP);
+	void adaptStrategy(mutation_strategy & strategy);
+	bool getOffspringDeltaFitness(size_t offspring_index, T * const * const next_genP,
+			double & fitness);
+
+	/**
+	 * an individual submitted for asynchronous evaluation
+	 */
+	struct async_evaluation
+	{
+		// shared with the evaluation task, which may outlive its deadline
+		shared_ptr<T> indivP;
+		future<double> fitness;
+		// set by the evaluation task when it starts (guarded by completion_mutex)
+		shared_ptr<chrono::steady_clock::time_point> deadlineP;
+	};
+
+	// evaluation threads (only in asynchronous mode)
+	unique_ptr<thread_pool> evaluation_poolP;
+	// evaluation tasks notify on start and completion
+	mutex completion_mutex;
+	condition_variable completion_condition;
+	// submitted evaluations that have not finished, including expired ones
+	// (guarded by completion_mutex)
+	size_t num_of_running_evaluations = 0;
+
+	async_evaluation submitEvaluation(const shared_ptr<T> & indivP);
+	bool hasFreeEvaluationThread(bool should_wait);
+	size_t waitForEvaluation(vector<async_evaluation> & evaluations, double & t_fitness);
+
+	// engine from which all other engines are created as independent streams
+	random_engine_type stream_random_engine;
+
 	// Roulette wheel random engine
-	mt19937 roulette_random_engine;
+	random_engine_type roulette_random_engine;
 	// crossover random engine
-	mt19937 crossover_random_engine;
+	random_engine_type crossover_random_engine;
 	// individual mutation random engine
-	mt19937 mutation_random_engine;
+	random_engine_type mutation_random_engine;
 	// elite replacement random engine
-	mt19937 replacement_random_engine;
+	random_engine_type replacement_random_engine;
+	// initial population random engine
+	random_engine_type initialization_random_engine;
+	// random engine for sampling pairs of individuals for diversity
+	random_engine_type diversity_random_engine;
+	// random engine for changing mutation strategies
+	random_engine_type strategy_random_engine;
+
+	void initBaseRandomEngines(uint64_t seed);
 
 	// generate uniformly distributed double value between 0 and 1
 	uniform_real_distribution<double> _uniform_distribution_0_1;
-	// generate uniformly distributed int value between 0 and (POPULATION_SIZE - 1)
-	uniform_int_distribution<int> _uniform_pop_distribution;
+	// generate uniformly distributed index between 0 and (POPULATION_SIZE - 1)
+	uniform_int_distribution<size_t> _uniform_pop_distribution;
 };
 
 /**
- * IMPLEMENTATION OF METHODS OF CLASS "simple_ga<T>"
- * =================================================
+ * IMPLEMENTATION OF METHODS OF CLASS "simple_ga<T, RandomEngine, Allocator>"
+ * ==========================================================================
  */
 
 /**
  * An optional method to change default parameter settings
  */
-template<typename T>
-void simple_ga<T>::setParameters(int population_size, int max_num_generations,
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setParameters(long long population_size,
+		long long max_num_generations,
 		double crossover_prob, double mutation_prob,
 		double allele_mutation_prob, bool elitism)
 {
@@ -282,11 +876,200 @@ void simple_ga<T>::setParameters(int population_size, int max_num_generations,
 	ELITISM = elitism;
 }
 
+/**
+ * An optional method to set seed of all random engines
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setSeed(uint64_t seed)
+{
+	initBaseRandomEngines(seed);
+	initRandomEngines();
+}
+
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::initBaseRandomEngines(uint64_t seed)
+{
+	stream_random_engine = random_engine_traits<random_engine_type>::create(seed);
+
+	roulette_random_engine = nextRandomStream();
+	crossover_random_engine = nextRandomStream();
+	mutation_random_engine = nextRandomStream();
+	replacement_random_engine = nextRandomStream();
+	initialization_random_engine = nextRandomStream();
+
+	// not taken from random streams, so that tracking diversity
+	// does not change random engines of derived class
+	diversity_random_engine =
+		random_engine_traits<random_engine_type>::create(splitmix64::mix(~seed));
+	strategy_random_engine =
+		random_engine_traits<random_engine_type>::create(splitmix64::mix(splitmix64::mix(~seed)));
+}
+
+/**
+ * current stream is returned and stream engine jumps ahead to the next stream
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+typename simple_ga<T, RandomEngine, Allocator>::random_engine_type
+simple_ga<T, RandomEngine, Allocator>::nextRandomStream()
+{
+	random_engine_type random_engine = stream_random_engine;
+	random_engine_traits<random_engine_type>::jump(stream_random_engine);
+	return random_engine;
+}
+
+/**
+ * An optional method to generate initial population with more than one thread
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setInitializationThreads(unsigned num_threads)
+{
+	if(num_threads >= 1)
+	{
+		INITIALIZATION_THREADS = num_threads;
+	}
+	else
+	{
+		cerr<<"error number of initialization threads : "<<num_threads
+				<<" (0 is not allowed). keeping "<<INITIALIZATION_THREADS<<endl;
+	}
+}
+
+/**
+ * An optional method to switch on asynchronous evaluation
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setAsyncEvaluation(unsigned num_threads)
+{
+	ASYNC_EVALUATION_THREADS = num_threads;
+}
+
+/**
+ * An optional method to set deadline of an asynchronous evaluation
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setEvaluationDeadline(int deadline_ms,
+		double penalty_fitness)
+{
+	EVALUATION_DEADLINE_MS = deadline_ms;
+	PENALTY_FITNESS = penalty_fitness;
+}
+
+/**
+ * An optional method to track diversity of population
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setDiversityTracking(bool track_diversity,
+		size_t num_of_sample_pairs)
+{
+	if(track_diversity && !genome_traits<T>::is_supported)
+	{
+		cerr<<"error diversity tracking : no genome_traits for type of individual,"
+				<<" only fitness variance is tracked"<<endl;
+	}
+
+	TRACK_DIVERSITY = track_diversity;
+	DIVERSITY_SAMPLE_PAIRS = num_of_sample_pairs;
+}
+
+/**
+ * An optional method to eliminate duplicate offspring
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setDuplicateElimination(bool eliminate_duplicates,
+		unsigned max_rebreed_attempts)
+{
+	if(eliminate_duplicates && !genome_traits<T>::is_supported)
+	{
+		cerr<<"error duplicate elimination : no genome_traits for type of individual,"
+				<<" keeping it off"<<endl;
+		return;
+	}
+
+	ELIMINATE_DUPLICATES = eliminate_duplicates;
+	MAX_REBREED_ATTEMPTS = max_rebreed_attempts;
+}
+
+/**
+ * An optional method to evolve population in chunks with pinned threads
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setLargePopulationMode(unsigned num_of_chunks,
+		unsigned mixing_interval, double migration_rate)
+{
+	NUM_OF_CHUNKS = num_of_chunks;
+	MIXING_INTERVAL = mixing_interval;
+	MIGRATION_RATE = migration_rate;
+}
+
+/**
+ * An optional method to switch on memetic mode
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setLocalSearch(size_t num_of_elites,
+		unsigned budget, bool lamarckian)
+{
+	LOCAL_SEARCH_ELITES = num_of_elites;
+	LOCAL_SEARCH_BUDGET = budget;
+	LAMARCKIAN = lamarckian;
+}
+
+/**
+ * An optional method to switch on delta evaluation
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setDeltaEvaluation(unsigned full_evaluation_interval)
+{
+	FULL_EVALUATION_INTERVAL = full_evaluation_interval;
+}
+
+/**
+ * An optional method to switch on self-adaptive mutation
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setSelfAdaptiveMutation(bool self_adaptive,
+		double initial_step_size, double learning_rate)
+{
+	if(initial_step_size <= 0 || learning_rate < 0)
+	{
+		cerr<<"error self-adaptive mutation : step size "<<initial_step_size
+				<<", learning rate "<<learning_rate<<" (step size must be positive and"
+				<<" learning rate not negative). keeping previous settings"<<endl;
+		return;
+	}
+	SELF_ADAPTIVE_MUTATION = self_adaptive;
+	MUTATION_STEP_SIZE = initial_step_size;
+	MUTATION_LEARNING_RATE = learning_rate;
+}
+
+/**
+ * An optional method to switch on surrogate pre-screening of offspring
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::setSurrogate(surrogate_model<T> * model,
+		double evaluated_fraction, double min_evaluated_fraction)
+{
+	if(evaluated_fraction <= 0 || evaluated_fraction > 1)
+	{
+		cerr<<"error surrogate evaluated fraction "<<evaluated_fraction
+				<<" is not in (0, 1]. keeping previous settings"<<endl;
+		return;
+	}
+	if(min_evaluated_fraction < 0 || min_evaluated_fraction > 1)
+	{
+		cerr<<"error surrogate minimum evaluated fraction "<<min_evaluated_fraction
+				<<" is not in [0, 1]. keeping previous settings"<<endl;
+		return;
+	}
+	surrogate_modelP = model;
+	SURROGATE_EVALUATED_FRACTION = model != NULL ? evaluated_fraction : 1;
+	SURROGATE_MIN_EVALUATED_FRACTION = model != NULL ? min_evaluated_fraction : 0;
+}
+
 /**
  * It displays parameter settings
  */
-template<typename T>
-void simple_ga<T>::displaySettings()
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::displaySettings()
 {
 	cout<<"**********G A Settings*************"<<endl;
 	cout<<"POPULATION_SIZE - "<<POPULATION_SIZE<<endl;
@@ -295,240 +1078,1706 @@ void simple_ga<T>::displaySettings()
 	cout<<"ELITISM ON(1)/OFF(0) - "<<ELITISM<<endl;
 	cout<<"MUTATION_PROBABILITY - "<<MUTATION_PROBABILITY<<endl;
 	cout<<"ALLELE_MUTATION_PROBABILITY - "<<ALLELE_MUTATION_PROBABILITY<<endl;
+	cout<<"INITIALIZATION_THREADS - "<<INITIALIZATION_THREADS<<endl;
+	cout<<"ASYNC_EVALUATION_THREADS - "<<ASYNC_EVALUATION_THREADS<<endl;
+	cout<<"EVALUATION_DEADLINE_MS - "<<EVALUATION_DEADLINE_MS<<endl;
+	cout<<"TRACK_DIVERSITY ON(1)/OFF(0) - "<<TRACK_DIVERSITY<<endl;
+	cout<<"ELIMINATE_DUPLICATES ON(1)/OFF(0) - "<<ELIMINATE_DUPLICATES<<endl;
+	cout<<"MAX_REBREED_ATTEMPTS - "<<MAX_REBREED_ATTEMPTS<<endl;
+	cout<<"LOCAL_SEARCH_ELITES - "<<LOCAL_SEARCH_ELITES<<endl;
+	cout<<"LOCAL_SEARCH_BUDGET - "<<LOCAL_SEARCH_BUDGET<<endl;
+	cout<<"LAMARCKIAN(1)/BALDWINIAN(0) - "<<LAMARCKIAN<<endl;
+	cout<<"FULL_EVALUATION_INTERVAL - "<<FULL_EVALUATION_INTERVAL<<endl;
+	cout<<"LAZY_EVALUATION ON(1)/OFF(0) - "<<LAZY_EVALUATION<<endl;
+	cout<<"SELF_ADAPTIVE_MUTATION ON(1)/OFF(0) - "<<SELF_ADAPTIVE_MUTATION<<endl;
+	cout<<"MUTATION_STEP_SIZE - "<<MUTATION_STEP_SIZE<<endl;
+	cout<<"SURROGATE_EVALUATED_FRACTION - "<<SURROGATE_EVALUATED_FRACTION<<endl;
+	cout<<"SURROGATE_MIN_EVALUATED_FRACTION - "<<SURROGATE_MIN_EVALUATED_FRACTION<<endl;
+	cout<<"NUM_OF_CHUNKS - "<<NUM_OF_CHUNKS<<endl;
+	cout<<"MIXING_INTERVAL - "<<MIXING_INTERVAL<<endl;
+	cout<<"MIGRATION_RATE - "<<MIGRATION_RATE<<endl;
 	cout<<"***********************************"<<endl;
 }
 
 /**
- * It runs GA with set prameter values
+ * It runs GA with set prameter values
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::run()
+{
+	// large population mode has its own initialization and generations
+	if(NUM_OF_CHUNKS > 0 && runLargePopulation())
+	{
+		return;
+	}
+
+	if(ASYNC_EVALUATION_THREADS > 0)
+	{
+		evaluation_poolP.reset(new thread_pool(ASYNC_EVALUATION_THREADS));
+		num_of_running_evaluations = 0;
+	}
+
+	resetStatistics();
+	initializeRandomPopulation();
+	updateStatistics();
+	updateDiversityStatistics();
+	writeTelemetry();
+
+	// atleast 2 indiv required
+	if(POPULATION_SIZE < 2)
+	{
+		cerr<<"error cannot perform GA for population size < 2"<<endl;
+		evaluation_poolP.reset();
+		return;
+	}
+
+	if(ASYNC_EVALUATION_THREADS > 0)
+	{
+		runAsync();
+
+		// wait for evaluations still running after their deadline
+		evaluation_poolP.reset();
+		return;
+	}
+
+	// allocate memory for next generation
+	T ** next_gen_population = new T * [ POPULATION_SIZE ];
+	T * const next_gen_storage = allocateIndivs(POPULATION_SIZE);
+	for(size_t i = 0 ; i < POPULATION_SIZE; i++)
+	{
+		*(next_gen_population + i) = next_gen_storage + i;
+	}
+
+	if(SELF_ADAPTIVE_MUTATION)
+	{
+		initStrategies();
+	}
+
+	num_of_generations = 0;
+	T * next_gen_indivP = NULL;
+	while(!shouldStop())
+	{
+		if(ELIMINATE_DUPLICATES)
+		{
+			resetDuplicateSet();
+		}
+
+		// changes are recorded in generations that are not fully evaluated
+		is_delta_generation = FULL_EVALUATION_INTERVAL > 1
+				&& (num_of_generations + 1) % FULL_EVALUATION_INTERVAL != 0;
+		if(is_delta_generation)
+		{
+			offspring_changes.resize(POPULATION_SIZE);
+		}
+		dirty_offspring.resize(POPULATION_SIZE);
+
+		// create new individuals for next generation
+		for(size_t i = 0; i < POPULATION_SIZE; i++)
+		{
+			next_gen_indivP = *(next_gen_population + i);
+
+			bool is_dirty = true;
+			if(_uniform_distribution_0_1(crossover_random_engine) <= CROSSOVER_PROBABILITY)
+			{
+				// offspring is created in its own individual (no temporary T)
+				beginChangeRecord(i, genome_change::NO_PARENT);
+				const crossoverParents crossover_parents = selectCrossOverParents();
+				breedStrategy(i, &crossover_parents);
+				crossOverInPlace(crossover_parents, *next_gen_indivP);
+			}
+			else
+			{
+				*next_gen_indivP = *(*(population + i));
+				beginChangeRecord(i, i);
+				breedStrategy(i, NULL);
+				is_dirty = false;
+			}
+
+			if(tryMutation(*next_gen_indivP))
+			{
+				is_dirty = true;
+			}
+			dirty_offspring[i] = is_dirty;
+
+			if(ELIMINATE_DUPLICATES)
+			{
+				eliminateDuplicate(next_gen_indivP, i);
+			}
+			recording_changeP = NULL;
+			mutating_strategyP = NULL;
+		}
+
+		// copy new individuals as current population
+		// and update fitness values
+		copyNextGeneration(next_gen_population);
+
+		if(LOCAL_SEARCH_ELITES > 0)
+		{
+			applyLocalSearch();
+		}
+
+		num_of_generations++;
+		updateStatistics();
+		updateDiversityStatistics();
+		scratch_arena.reset();
+
+		// display best fitness for each generation
+		writeTelemetry();
+		displayGenerationProgress();
+	}
+
+	// free memory for next generation
+	deallocateIndivs(next_gen_storage, POPULATION_SIZE);
+	delete [ ] next_gen_population;
+
+}
+
+
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::initializeRandomPopulation()
+{
+	// free memory of previous run if population size has changed
+	if(population != NULL && population_capacity != POPULATION_SIZE)
+	{
+		deallocateIndivs(population_storage, population_capacity);
+		delete [ ] population;
+		population = NULL;
+
+		if(fitness_mapP != NULL)
+		{
+			fitness_mapP->clear();
+			cumulative_mapP->clear();
+		}
+	}
+
+	// allocate memory if not initialized yet
+	if(population == NULL)
+	{
+		population = new T* [ POPULATION_SIZE ];
+		population_storage = allocateIndivs(POPULATION_SIZE);
+		population_capacity = POPULATION_SIZE;
+
+		// point each member to its individual in the block
+		for(size_t i = 0 ; i < POPULATION_SIZE; i++)
+		{
+			*(population + i) = population_storage + i;
+		}
+	}
+
+	if(fitness_mapP == NULL)
+	{
+		fitness_mapP = new fitness_map_type;
+	}
+
+	if(cumulative_mapP == NULL)
+	{
+		cumulative_mapP = new fitness_map_type;
+	}
+
+	T * indivP;
+	if(VERBOSE)
+	{
+		cout<<"generating random individuals.."<<endl;
+	}
+	generateRandomPopulation();
+	for(size_t i = 0 ; VERBOSE && i < POPULATION_SIZE; i++)
+	{
+		indivP = *(population + i);
+		this->displayIndiv(*indivP);
+	}
+
+	// initialize uniform distributions
+	_uniform_distribution_0_1 =
+		uniform_real_distribution<double> (0, 1);
+
+	_uniform_pop_distribution =
+		uniform_int_distribution<size_t> (0, POPULATION_SIZE - 1);
+
+
+	generation_fitness.resize(POPULATION_SIZE);
+	evaluatePopulation(population, generation_fitness.data(), POPULATION_SIZE);
+	updateSurrogate(population, generation_fitness.data(), POPULATION_SIZE);
+
+	fitness_sum = 0;
+	fitness_square_sum = 0;
+	// initialize best and min fitness for this generation
+	gen_best_fitness = - DBL_MAX;
+	gen_min_fitness = DBL_MAX;
+	double t_fitness;
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		indivP = *(population + i);
+
+		t_fitness = generation_fitness[i];
+		(*fitness_mapP)[indivP] = t_fitness;
+
+		fitness_sum += t_fitness;
+		fitness_square_sum += t_fitness*t_fitness;
+		updateCurrentGenMinMaxFitness(i, t_fitness);
+	}
+
+	best_fitness = gen_best_fitness;
+	best_individual = *(*(population + gen_best_index));
+	avg_fitness = (double) fitness_sum/POPULATION_SIZE;
+
+	// set the cumulative fitness map
+	resetCumulativeMap();
+}
+
+
+/**
+ * allocate a block of default constructed individuals with allocator of GA
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+T * simple_ga<T, RandomEngine, Allocator>::allocateIndivs(size_t num_of_indivs)
+{
+	typedef allocator_traits<Allocator> allocator_traits_type;
+
+	T * const indivs = allocator_traits_type::allocate(genome_allocator, num_of_indivs);
+	for(size_t i = 0; i < num_of_indivs; i++)
+	{
+		allocator_traits_type::construct(genome_allocator, indivs + i);
+	}
+	return indivs;
+}
+
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::deallocateIndivs(T * indivs,
+		size_t num_of_indivs)
+{
+	typedef allocator_traits<Allocator> allocator_traits_type;
+
+	for(size_t i = 0; i < num_of_indivs; i++)
+	{
+		allocator_traits_type::destroy(genome_allocator, indivs + i);
+	}
+	allocator_traits_type::deallocate(genome_allocator, indivs, num_of_indivs);
+}
+
+/**
+ * generate a random individual for each member of the population.
+ * Population is divided into fixed blocks and each block uses its own
+ * random engine (seeded from the GA's initialization random engine),
+ * so the generated population does not depend on the number of threads.
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::generateRandomPopulation()
+{
+	const size_t BLOCK_SIZE = 64;
+	const size_t num_of_blocks = (POPULATION_SIZE + BLOCK_SIZE - 1)/BLOCK_SIZE;
+	const uint64_t base_seed = initialization_random_engine();
+
+	auto generateBlock = [this, base_seed, BLOCK_SIZE](size_t block) -> bool
+	{
+		random_engine_type block_random_engine = random_engine_traits<random_engine_type>::
+			create(splitmix64::mix(base_seed + block));
+
+		const size_t end = min(POPULATION_SIZE, (block + 1)*BLOCK_SIZE);
+		for(size_t i = block*BLOCK_SIZE; i < end; i++)
+		{
+			if(!generateRandomIndiv(*(*(population + i)), block_random_engine))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	// first block is generated in this thread, it also checks
+	// whether derived class supports generation with a given engine
+	if(!generateBlock(0))
+	{
+		for(size_t i = 0 ; i < POPULATION_SIZE; i++)
+		{
+			*(*(population + i)) = getRandomIndiv();
+		}
+		return;
+	}
+
+	// each thread takes the next block not taken yet
+	atomic<size_t> next_block(1);
+	auto generateBlocks = [&next_block, num_of_blocks, &generateBlock]()
+	{
+		for(size_t block = next_block++; block < num_of_blocks; block = next_block++)
+		{
+			generateBlock(block);
+		}
+	};
+
+	const size_t num_of_threads = min((size_t) INITIALIZATION_THREADS, num_of_blocks);
+	vector<thread> threads;
+	for(size_t t = 1; t < num_of_threads; t++)
+	{
+		threads.push_back(thread(generateBlocks));
+	}
+	generateBlocks();
+
+	for(thread & a_thread : threads)
+	{
+		a_thread.join();
+	}
+}
+
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::copyNextGeneration(T * const * const next_genP)
+{
+	// store last generation best fitness
+	const double prev_gen_best_fitness = gen_best_fitness;
+	const size_t prev_gen_best_index = gen_best_index;
+
+	// initialize best and min fitness for this generation
+	gen_best_fitness = - DBL_MAX;
+	gen_min_fitness = DBL_MAX;
+
+	double t_fitness;
+	T * indivP;
+	// swap contents instead of copying, so that individuals of
+	// last generation are now in next_genP (at same indices)
+	using std::swap;
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		swap(*( *(population + i) ), *( *(next_genP + i) ));
+	}
+	if(SELF_ADAPTIVE_MUTATION)
+	{
+		population_strategies.swap(next_gen_strategies);
+	}
+
+	if(ELIMINATE_DUPLICATES || is_delta_generation || LAZY_EVALUATION
+			|| surrogate_modelP != NULL)
+	{
+		evaluateOffspring(next_genP);
+	}
+	else
+	{
+		generation_fitness.resize(POPULATION_SIZE);
+		evaluatePopulation(population, generation_fitness.data(), POPULATION_SIZE);
+	}
+
+	fitness_sum = 0;
+	fitness_square_sum = 0;
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		indivP = *(population + i);
+
+		t_fitness = generation_fitness[i];
+		fitness_mapP->find(indivP)->second = t_fitness;
+		fitness_sum += t_fitness;
+		fitness_square_sum += t_fitness*t_fitness;
+		updateCurrentGenMinMaxFitness(i, t_fitness);
+	}
+
+	// replace randomly selected individual with previous best individual
+	if(ELITISM)
+	{
+		// generate a random index for replacement
+		const size_t random_replacement_index =
+			_uniform_pop_distribution(replacement_random_engine);
+
+		T * const replacement_indivP = *(population + random_replacement_index);
+		const double replacement_indiv_fitness =
+			fitness_mapP->find(replacement_indivP)->second;
+
+		// replace randomly selected individual with best known individual
+		// of previous generation (moved, since last generation is not needed any more)
+		*replacement_indivP = std::move(*(*(next_genP + prev_gen_best_index)));
+		fitness_mapP->find(replacement_indivP)->second = prev_gen_best_fitness;
+		if(SELF_ADAPTIVE_MUTATION)
+		{
+			population_strategies[random_replacement_index] =
+				next_gen_strategies[prev_gen_best_index];
+		}
+
+		// adjust fitness sum for replaced individual
+		fitness_sum += prev_gen_best_fitness - replacement_indiv_fitness;
+		fitness_square_sum += prev_gen_best_fitness*prev_gen_best_fitness
+				- replacement_indiv_fitness*replacement_indiv_fitness;
+
+		// update max fitness if replaced
+		if(replacement_indiv_fitness == gen_best_fitness)
+		{
+			gen_best_fitness = - DBL_MAX;
+			for(size_t i = 0; i < POPULATION_SIZE; i++)
+			{
+				t_fitness = fitness_mapP->find(*(population + i))->second;
+				if(t_fitness >= gen_best_fitness)
+				{
+					gen_best_index = i;
+					gen_best_fitness = t_fitness;
+				}
+			}
+		}
+
+		// update min fitness if replaced
+		if(replacement_indiv_fitness == gen_min_fitness)
+		{
+			gen_min_fitness = DBL_MAX;
+			for(size_t i = 0; i < POPULATION_SIZE; i++)
+			{
+				t_fitness = fitness_mapP->find(*(population + i))->second;
+				if(t_fitness <= gen_min_fitness)
+				{
+					gen_min_fitness = t_fitness;
+				}
+			}
+		}
+	}
+
+	// update best known result so far
+	// (only copy of an individual that is made for each generation)
+	if(gen_best_fitness > best_fitness)
+	{
+		best_fitness = gen_best_fitness;
+		best_individual = *(*(population + gen_best_index));
+	}
+
+	avg_fitness = (double) fitness_sum/POPULATION_SIZE;
+
+	// reset cumulative fitness map for this population
+	resetCumulativeMap();
+}
+
+/**
+ * run local search on best individuals of current generation,
+ * and update fitness of population with their new fitness
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::applyLocalSearch()
+{
+	const size_t num_of_elites = min(LOCAL_SEARCH_ELITES, POPULATION_SIZE);
+
+	// find best individuals (only they are sorted)
+	local_search_order.resize(POPULATION_SIZE);
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		local_search_order[i] = i;
+	}
+	partial_sort(local_search_order.begin(), local_search_order.begin() + num_of_elites,
+			local_search_order.end(), [this](size_t i, size_t j)
+	{
+		return fitness_mapP->find(*(population + i))->second
+			> fitness_mapP->find(*(population + j))->second;
+	});
+
+	for(size_t e = 0; e < num_of_elites; e++)
+	{
+		T * const indivP = *(population + local_search_order[e]);
+		double & indiv_fitness = fitness_mapP->find(indivP)->second;
+
+		// Baldwinian search works on a copy, so individual is not changed
+		T & searched_indiv = LAMARCKIAN ? *indivP : local_search_indiv;
+		if(!LAMARCKIAN)
+		{
+			local_search_indiv = *indivP;
+		}
+
+		const double old_fitness = indiv_fitness;
+		const double new_fitness = localSearch(searched_indiv, old_fitness, LOCAL_SEARCH_BUDGET);
+		statistics.num_of_local_searches++;
+		if(new_fitness > old_fitness)
+		{
+			statistics.num_of_local_search_improvements++;
+		}
+
+		indiv_fitness = new_fitness;
+		fitness_sum += new_fitness - old_fitness;
+		fitness_square_sum += new_fitness*new_fitness - old_fitness*old_fitness;
+
+		// best known individual is the one that was searched (also in Baldwinian mode)
+		if(new_fitness > best_fitness)
+		{
+			best_fitness = new_fitness;
+			best_individual = searched_indiv;
+		}
+	}
+
+	findCurrentGenMinMaxFitness();
+	avg_fitness = (double) fitness_sum/POPULATION_SIZE;
+
+	// reset cumulative fitness map for changed fitness values
+	resetCumulativeMap();
+}
+
+/**
+ * LARGE POPULATION MODE
+ * =====================
+ * Population is divided into chunks of consecutive individuals, and each chunk is
+ * evolved by its own thread pinned to a CPU (like an island). A thread constructs
+ * individuals of its chunk and its vectors, so that with first touch policy of the OS
+ * their memory is on NUMA node of its CPU, and a generation does not use memory of
+ * other nodes. Selection (roulette wheel), crossover, mutation and elitism are done
+ * within a chunk. Every MIXING_INTERVAL generations best individuals of each chunk
+ * (MIGRATION_RATE of it) replace random individuals of next chunk (ring), which is
+ * the only time a thread reads memory of another chunk.
+ *
+ * Threads wait for each other only at end of a phase (a generation or a migration),
+ * then statistics of chunks are combined by this thread.
+ * Results depend on number of chunks (each chunk has its own random engine).
+ *
+ * Returns false (without running) if derived class has no thread safe operators.
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+bool simple_ga<T, RandomEngine, Allocator>::runLargePopulation()
+{
+	// operators are checked with a copy of engine, so that GA is not changed
+	{
+		random_engine_type check_random_engine = initialization_random_engine;
+		T check_parent1, check_parent2, check_offspring;
+		crossoverParents check_parents;
+		check_parents.parent1 = &check_parent1;
+		check_parents.parent2 = &check_parent2;
+		const bool is_supported = generateRandomIndiv(check_parent1, check_random_engine)
+			&& generateRandomIndiv(check_parent2, check_random_engine)
+			&& crossOverWithEngine(check_parents, check_offspring, check_random_engine)
+			&& mutateWithEngine(check_offspring, check_random_engine);
+		threadScratchArena().reset();
+		if(!is_supported)
+		{
+			cerr<<"error large population mode needs generateRandomIndiv, crossOverWithEngine"
+					<<" and mutateWithEngine with a given random engine."
+					<<" running generational GA"<<endl;
+			return false;
+		}
+	}
+
+	// atleast 2 indiv required in each chunk
+	if(POPULATION_SIZE < 4)
+	{
+		cerr<<"error large population mode needs population size >= 4."
+				<<" running generational GA"<<endl;
+		return false;
+	}
+	const size_t num_of_chunks = min((size_t) NUM_OF_CHUNKS, POPULATION_SIZE/2);
+
+	resetStatistics();
+
+	// free population of previous run, individuals of chunks are constructed by their threads
+	if(population != NULL)
+	{
+		deallocateIndivs(population_storage, population_capacity);
+		delete [ ] population;
+	}
+	if(fitness_mapP != NULL)
+	{
+		fitness_mapP->clear();
+		cumulative_mapP->clear();
+	}
+
+	typedef allocator_traits<Allocator> allocator_traits_type;
+	population = new T* [ POPULATION_SIZE ];
+	population_storage = allocator_traits_type::allocate(genome_allocator, POPULATION_SIZE);
+	population_capacity = POPULATION_SIZE;
+	next_gen_chunk_storage = allocator_traits_type::allocate(genome_allocator, POPULATION_SIZE);
+
+	const uint64_t base_seed = initialization_random_engine();
+	chunks.clear();
+	chunks.resize(num_of_chunks);
+	for(size_t c = 0; c < num_of_chunks; c++)
+	{
+		chunks[c].begin = c*POPULATION_SIZE/num_of_chunks;
+		chunks[c].end = (c + 1)*POPULATION_SIZE/num_of_chunks;
+		chunks[c].random_engine = random_engine_traits<random_engine_type>::
+			create(splitmix64::mix(base_seed + c));
+	}
+
+	// a thread for each chunk, pinned to allowed CPUs in turn
+	// (they start with first phase after phase number 0)
+	chunk_phase_number = 0;
+	const vector<unsigned> cpus = getAllowedCpus();
+	vector<thread> chunk_threads;
+	for(size_t c = 0; c < num_of_chunks; c++)
+	{
+		chunk_threads.push_back(thread(&simple_ga::runChunkThread, this, c));
+		pinThread(chunk_threads.back(), cpus[c % cpus.size()]);
+	}
+
+	// combine statistics of chunks into statistics of generation
+	auto collectChunkStatistics = [this]()
+	{
+		gen_best_fitness = - DBL_MAX;
+		gen_min_fitness = DBL_MAX;
+		fitness_sum = 0;
+		fitness_square_sum = 0;
+		for(const population_chunk & chunk : chunks)
+		{
+			if(chunk.best_fitness >= gen_best_fitness)
+			{
+				gen_best_fitness = chunk.best_fitness;
+				gen_best_index = chunk.best_index;
+			}
+			gen_min_fitness = min(gen_min_fitness, chunk.min_fitness);
+			fitness_sum += chunk.fitness_sum;
+			fitness_square_sum += chunk.fitness_square_sum;
+		}
+		avg_fitness = (double) fitness_sum/POPULATION_SIZE;
+	};
+
+	if(VERBOSE)
+	{
+		cout<<"generating random individuals.."<<endl;
+	}
+	num_of_generations = 0;
+	runChunkPhase(CHUNK_INIT);
+	statistics.num_of_evaluations += POPULATION_SIZE;
+	collectChunkStatistics();
+	best_fitness = gen_best_fitness;
+	best_individual = *(*(population + gen_best_index));
+
+	updateStatistics();
+	updateDiversityStatistics();
+	writeTelemetry();
+	displayGenerationProgress();
+
+	while(!shouldStop())
+	{
+		runChunkPhase(CHUNK_GENERATION);
+		statistics.num_of_evaluations += POPULATION_SIZE;
+		num_of_generations++;
+
+		if(MIXING_INTERVAL > 0 && num_of_chunks > 1 && num_of_generations % MIXING_INTERVAL == 0)
+		{
+			runChunkPhase(CHUNK_EMIGRATE);
+			runChunkPhase(CHUNK_IMMIGRATE);
+		}
+
+		collectChunkStatistics();
+		if(gen_best_fitness > best_fitness)
+		{
+			best_fitness = gen_best_fitness;
+			best_individual = *(*(population + gen_best_index));
+		}
+
+		updateStatistics();
+		updateDiversityStatistics();
+		writeTelemetry();
+		displayGenerationProgress();
+	}
+
+	runChunkPhase(CHUNK_STOP);
+	for(thread & chunk_thread : chunk_threads)
+	{
+		chunk_thread.join();
+	}
+
+	// free memory for next generation (population is kept for results)
+	deallocateIndivs(next_gen_chunk_storage, POPULATION_SIZE);
+	next_gen_chunk_storage = NULL;
+	chunks.clear();
+	return true;
+}
+
+/**
+ * start a phase in all threads of chunks, and wait until they finish it
+ * (threads of chunks exit in stop phase, so it is not waited)
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::runChunkPhase(chunk_phase phase)
+{
+	{
+		lock_guard<mutex> lock(chunk_mutex);
+		current_chunk_phase = phase;
+		num_of_running_chunks = chunks.size();
+		chunk_phase_number++;
+	}
+	chunk_phase_started.notify_all();
+
+	if(phase == CHUNK_STOP)
+	{
+		return;
+	}
+
+	unique_lock<mutex> lock(chunk_mutex);
+	chunk_phase_finished.wait(lock, [this]() { return num_of_running_chunks == 0; });
+}
+
+/**
+ * thread of chunk c, it runs each phase on its chunk until stop phase
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::runChunkThread(size_t c)
+{
+	unsigned long long last_phase_number = 0;
+	while(true)
+	{
+		chunk_phase phase;
+		{
+			unique_lock<mutex> lock(chunk_mutex);
+			chunk_phase_started.wait(lock, [this, last_phase_number]()
+					{ return chunk_phase_number != last_phase_number; });
+			last_phase_number = chunk_phase_number;
+			phase = current_chunk_phase;
+		}
+
+		population_chunk & chunk = chunks[c];
+		switch(phase)
+		{
+		case CHUNK_INIT:
+			initChunk(chunk);
+			break;
+		case CHUNK_GENERATION:
+			breedChunk(chunk);
+			break;
+		case CHUNK_EMIGRATE:
+			selectEmigrants(chunk);
+			break;
+		case CHUNK_IMMIGRATE:
+			// emigrants of previous chunk (ring of chunks)
+			insertImmigrants(chunk, chunks[(c + chunks.size() - 1) % chunks.size()]);
+			break;
+		case CHUNK_STOP:
+			return;
+		}
+		threadScratchArena().reset();
+
+		lock_guard<mutex> lock(chunk_mutex);
+		if(--num_of_running_chunks == 0)
+		{
+			chunk_phase_finished.notify_all();
+		}
+	}
+}
+
+/**
+ * construct and evaluate random individuals of a chunk (in thread of chunk)
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::initChunk(population_chunk & chunk)
+{
+	typedef allocator_traits<Allocator> allocator_traits_type;
+
+	const size_t chunk_size = chunk.end - chunk.begin;
+	chunk.fitness.resize(chunk_size);
+	chunk.next_fitness.resize(chunk_size);
+	chunk.cumulative_fitness.resize(chunk_size);
+
+	for(size_t i = chunk.begin; i < chunk.end; i++)
+	{
+		allocator_traits_type::construct(genome_allocator, population_storage + i);
+		allocator_traits_type::construct(genome_allocator, next_gen_chunk_storage + i);
+		*(population + i) = population_storage + i;
+
+		generateRandomIndiv(*(*(population + i)), chunk.random_engine);
+		chunk.fitness[i - chunk.begin] = getFitness(*(*(population + i)));
+	}
+	updateChunkStatistics(chunk);
+}
+
+/**
+ * breed next generation of a chunk from its parents (in thread of chunk)
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::breedChunk(population_chunk & chunk)
+{
+	const size_t chunk_size = chunk.end - chunk.begin;
+
+	// cumulative relative fitness, shifted by min fitness of chunk
+	// (all individuals are equally likely if they have the same fitness)
+	const double total_fitness = chunk.fitness_sum - chunk_size*chunk.min_fitness;
+	double cumulative_fitness = 0;
+	for(size_t k = 0; k < chunk_size; k++)
+	{
+		cumulative_fitness += total_fitness > 0 ?
+				(chunk.fitness[k] - chunk.min_fitness)/total_fitness : 1.0/chunk_size;
+		chunk.cumulative_fitness[k] = cumulative_fitness;
+	}
+
+	uniform_real_distribution<double> uniform_distribution_0_1(0, 1);
+	crossoverParents crossover_parents;
+	for(size_t i = chunk.begin; i < chunk.end; i++)
+	{
+		T & offspring = *(next_gen_chunk_storage + i);
+		if(uniform_distribution_0_1(chunk.random_engine) <= CROSSOVER_PROBABILITY)
+		{
+			const size_t first_index = selectChunkParent(chunk, chunk_size);
+			const size_t second_index = selectChunkParent(chunk, first_index);
+			crossover_parents.parent1 = *(population + chunk.begin + first_index);
+			crossover_parents.parent2 = *(population + chunk.begin + second_index);
+			crossOverWithEngine(crossover_parents, offspring, chunk.random_engine);
+		}
+		else
+		{
+			offspring = *(*(population + i));
+		}
+
+		if(uniform_distribution_0_1(chunk.random_engine) <= MUTATION_PROBABILITY)
+		{
+			mutateWithEngine(offspring, chunk.random_engine);
+		}
+		chunk.next_fitness[i - chunk.begin] = getFitness(offspring);
+	}
+
+	// offspring become population, and parents are kept in next generation storage
+	using std::swap;
+	for(size_t i = chunk.begin; i < chunk.end; i++)
+	{
+		swap(*(*(population + i)), *(next_gen_chunk_storage + i));
+	}
+	chunk.fitness.swap(chunk.next_fitness);
+
+	// best parent of chunk replaces a random offspring
+	if(ELITISM)
+	{
+		uniform_int_distribution<size_t> chunk_distribution(chunk.begin, chunk.end - 1);
+		const size_t replacement_index = chunk_distribution(chunk.random_engine);
+		*(*(population + replacement_index)) = std::move(*(next_gen_chunk_storage + chunk.best_index));
+		chunk.fitness[replacement_index - chunk.begin] = chunk.best_fitness;
+	}
+
+	updateChunkStatistics(chunk);
+}
+
+/**
+ * roulette wheel selection of a parent within a chunk (index in chunk),
+ * next individual is taken if already selected parent is selected again
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+size_t simple_ga<T, RandomEngine, Allocator>::selectChunkParent(population_chunk & chunk,
+		size_t already_selected)
+{
+	uniform_real_distribution<double> uniform_distribution_0_1(0, 1);
+	const double random_value = uniform_distribution_0_1(chunk.random_engine);
+	const size_t chunk_size = chunk.end - chunk.begin;
+
+	size_t selected = upper_bound(chunk.cumulative_fitness.begin(), chunk.cumulative_fitness.end(),
+			random_value) - chunk.cumulative_fitness.begin();
+	if(selected >= chunk_size)
+	{
+		selected = chunk_size - 1;
+	}
+	if(selected == already_selected)
+	{
+		selected = (selected + 1) % chunk_size;
+	}
+	return selected;
+}
+
+/**
+ * copy best individuals of a chunk (MIGRATION_RATE of it, atleast one) to its emigrants
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::selectEmigrants(population_chunk & chunk)
+{
+	const size_t chunk_size = chunk.end - chunk.begin;
+	const size_t num_of_emigrants = min(chunk_size - 1,
+			max((size_t) 1, (size_t) (MIGRATION_RATE*chunk_size)));
+
+	// only best individuals are found (not sorted)
+	arena_vector<size_t> order(chunk_size, 0, arena_allocator<size_t>(threadScratchArena()));
+	for(size_t k = 0; k < chunk_size; k++)
+	{
+		order[k] = k;
+	}
+	nth_element(order.begin(), order.begin() + num_of_emigrants - 1, order.end(),
+			[&chunk](size_t k1, size_t k2) { return chunk.fitness[k1] > chunk.fitness[k2]; });
+
+	chunk.emigrants.resize(num_of_emigrants);
+	chunk.emigrant_fitness.resize(num_of_emigrants);
+	for(size_t e = 0; e < num_of_emigrants; e++)
+	{
+		chunk.emigrants[e] = *(*(population + chunk.begin + order[e]));
+		chunk.emigrant_fitness[e] = chunk.fitness[order[e]];
+	}
+}
+
+/**
+ * emigrants of source chunk replace random individuals of chunk (except its best)
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::insertImmigrants(population_chunk & chunk,
+		const population_chunk & source_chunk)
+{
+	uniform_int_distribution<size_t> chunk_distribution(chunk.begin, chunk.end - 1);
+	for(size_t e = 0; e < source_chunk.emigrants.size(); e++)
+	{
+		size_t replacement_index;
+		do
+		{
+			replacement_index = chunk_distribution(chunk.random_engine);
+		} while(replacement_index == chunk.best_index);
+
+		*(*(population + replacement_index)) = source_chunk.emigrants[e];
+		chunk.fitness[replacement_index - chunk.begin] = source_chunk.emigrant_fitness[e];
+	}
+	updateChunkStatistics(chunk);
+}
+
+/**
+ * best, min, sum and sum of squares of fitness of a chunk
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::updateChunkStatistics(population_chunk & chunk)
+{
+	chunk.best_fitness = - DBL_MAX;
+	chunk.min_fitness = DBL_MAX;
+	chunk.fitness_sum = 0;
+	chunk.fitness_square_sum = 0;
+	for(size_t i = chunk.begin; i < chunk.end; i++)
+	{
+		const double t_fitness = chunk.fitness[i - chunk.begin];
+		if(t_fitness >= chunk.best_fitness)
+		{
+			chunk.best_fitness = t_fitness;
+			chunk.best_index = i;
+		}
+		chunk.min_fitness = min(chunk.min_fitness, t_fitness);
+		chunk.fitness_sum += t_fitness;
+		chunk.fitness_square_sum += t_fitness*t_fitness;
+	}
+}
+
+/**
+ * put parents (with their fitness) in duplicate set before breeding a generation
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::resetDuplicateSet()
+{
+	duplicate_set.clear(2*POPULATION_SIZE);
+	duplicate_sources.assign(POPULATION_SIZE, NOT_DUPLICATE);
+	generation_fitness.resize(POPULATION_SIZE);
+
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		const T * const indivP = *(population + i);
+		duplicate_set.findOrInsert(indivP, fitness_mapP->find(indivP)->second,
+				PARENT_DUPLICATE);
+	}
+}
+
+/**
+ * breed an offspring again if it is a duplicate (when rebreeding is allowed),
+ * otherwise note which individual it duplicates
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::eliminateDuplicate(T * const offspringP,
+		size_t offspring_index)
+{
+	const typename genome_hash_set<T>::entry * duplicateP =
+		duplicate_set.findOrInsert(offspringP, 0, offspring_index);
+
+	for(unsigned attempt = 0; duplicateP != NULL && attempt < MAX_REBREED_ATTEMPTS; attempt++)
+	{
+		beginChangeRecord(offspring_index, genome_change::NO_PARENT);
+		dirty_offspring[offspring_index] = true;
+		crossOverInPlace(selectCrossOverParents(), *offspringP);
+		mutate(*offspringP);
+		statistics.num_of_rebred_offspring++;
+
+		duplicateP = duplicate_set.findOrInsert(offspringP, 0, offspring_index);
+	}
+
+	// a duplicate of a parent is evaluated when fitness of parent is not its own
+	if(duplicateP != NULL && duplicateP->index == PARENT_DUPLICATE && !isParentFitnessExact())
+	{
+		duplicateP = NULL;
+	}
+
+	if(duplicateP != NULL)
+	{
+		statistics.num_of_duplicate_offspring++;
+		duplicate_sources[offspring_index] = duplicateP->index;
+		generation_fitness[offspring_index] = duplicateP->fitness;
+	}
+}
+
+/**
+ * calculate fitness of offspring (now in population) : duplicates get fitness of
+ * individuals they duplicate, unchanged copies keep fitness of their parent (lazy
+ * evaluation), offspring with recorded changes get fitness from their base parent
+ * (now in next_genP) with getFitnessDelta, and others are evaluated (only the most
+ * promising of them with a surrogate model, rest are replaced by their parents).
+ * Fitness of parents is not reused (by any of these) after Baldwinian local search.
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::evaluateOffspring(T * const * const next_genP)
+{
+	const bool is_parent_fitness_exact = isParentFitnessExact();
+
+	generation_fitness.resize(POPULATION_SIZE);
+	unique_indivs.clear();
+	unique_indices.clear();
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		if(ELIMINATE_DUPLICATES && duplicate_sources[i] != NOT_DUPLICATE)
+		{
+			continue;
+		}
+		if(LAZY_EVALUATION && is_parent_fitness_exact && !dirty_offspring[i])
+		{
+			// parent was at same index, its fitness is not updated yet
+			generation_fitness[i] = fitness_mapP->find(*(population + i))->second;
+			statistics.num_of_unchanged_offspring++;
+			continue;
+		}
+		if(is_delta_generation && is_parent_fitness_exact
+				&& getOffspringDeltaFitness(i, next_genP, generation_fitness[i]))
+		{
+			continue;
+		}
+		unique_indivs.push_back(*(population + i));
+		unique_indices.push_back(i);
+	}
+
+	if(surrogate_modelP != NULL)
+	{
+		surrogate_rejected.assign(POPULATION_SIZE, 0);
+		if(is_parent_fitness_exact)
+		{
+			screenWithSurrogate(next_genP);
+		}
+	}
+
+	unique_fitness.resize(unique_indivs.size());
+	evaluatePopulation(unique_indivs.data(), unique_fitness.data(), unique_indivs.size());
+	for(size_t k = 0; k < unique_indices.size(); k++)
+	{
+		generation_fitness[unique_indices[k]] = unique_fitness[k];
+	}
+	updateSurrogate(unique_indivs.data(), unique_fitness.data(), unique_indivs.size());
+
+	// duplicates of earlier offspring (already evaluated, or replaced by their parent
+	// then duplicates are replaced by their own parent too),
+	// duplicates of parents already have their fitness
+	for(size_t i = 0; ELIMINATE_DUPLICATES && i < POPULATION_SIZE; i++)
+	{
+		const long long source = duplicate_sources[i];
+		if(source != NOT_DUPLICATE && source != PARENT_DUPLICATE)
+		{
+			if(surrogate_modelP != NULL && surrogate_rejected[source])
+			{
+				revertToParent(i, next_genP);
+			}
+			else
+			{
+				generation_fitness[i] = generation_fitness[source];
+			}
+		}
+	}
+}
+
+/**
+ * predict fitness of offspring to evaluate (unique_indivs) with surrogate model.
+ * Offspring in archive of model get their archived fitness (fitness of an individual
+ * is taken as fixed, as in lazy evaluation), and only SURROGATE_EVALUATED_FRACTION of
+ * other offspring with best predictions are evaluated (but at least
+ * SURROGATE_MIN_EVALUATED_FRACTION of population size). Rest are replaced by their parent.
+ * Nothing is screened while model can not predict.
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::screenWithSurrogate(T * const * const next_genP)
+{
+	const size_t num_of_candidates = unique_indivs.size();
+	surrogate_predictions.resize(num_of_candidates);
+	surrogate_order.clear();
+	vector<char> is_archived(num_of_candidates, 0);
+	for(size_t k = 0; k < num_of_candidates; k++)
+	{
+		bool is_archived_indiv = false;
+		if(!surrogate_modelP->predict(*unique_indivs[k], surrogate_predictions[k],
+				is_archived_indiv))
+		{
+			return;
+		}
+		if(is_archived_indiv && LAZY_EVALUATION)
+		{
+			is_archived[k] = 1;
+		}
+		else
+		{
+			surrogate_order.push_back(k);
+		}
+	}
+	for(size_t k = 0; k < num_of_candidates; k++)
+	{
+		if(is_archived[k])
+		{
+			generation_fitness[unique_indices[k]] = surrogate_predictions[k];
+			statistics.num_of_surrogate_saved_evaluations++;
+		}
+	}
+
+	// best predictions first (in order of index among equal predictions)
+	const size_t num_to_evaluate = min(surrogate_order.size(),
+			max((size_t) ceil(SURROGATE_EVALUATED_FRACTION*surrogate_order.size()),
+			(size_t) ceil(SURROGATE_MIN_EVALUATED_FRACTION*POPULATION_SIZE)));
+	nth_element(surrogate_order.begin(), surrogate_order.begin() + num_to_evaluate,
+			surrogate_order.end(), [this](size_t k1, size_t k2)
+	{
+		return surrogate_predictions[k1] > surrogate_predictions[k2]
+			|| (surrogate_predictions[k1] == surrogate_predictions[k2] && k1 < k2);
+	});
+	for(size_t r = num_to_evaluate; r < surrogate_order.size(); r++)
+	{
+		const size_t offspring_index = unique_indices[surrogate_order[r]];
+		revertToParent(offspring_index, next_genP);
+		surrogate_rejected[offspring_index] = 1;
+		statistics.num_of_surrogate_saved_evaluations++;
+	}
+
+	// remaining offspring are evaluated (in order of index)
+	size_t num_of_kept = 0;
+	for(size_t k = 0; k < num_of_candidates; k++)
+	{
+		if(!is_archived[k] && !surrogate_rejected[unique_indices[k]])
+		{
+			unique_indivs[num_of_kept] = unique_indivs[k];
+			unique_indices[num_of_kept] = unique_indices[k];
+			num_of_kept++;
+		}
+	}
+	unique_indivs.resize(num_of_kept);
+	unique_indices.resize(num_of_kept);
+}
+
+/**
+ * replace an offspring with a copy of its parent (at same index of last generation,
+ * now in next_genP), with fitness and mutation strategy of parent
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::revertToParent(size_t offspring_index,
+		T * const * const next_genP)
+{
+	T * const offspringP = *(population + offspring_index);
+	*offspringP = *(*(next_genP + offspring_index));
+	// fitness of parent is not updated yet
+	generation_fitness[offspring_index] = fitness_mapP->find(offspringP)->second;
+	if(SELF_ADAPTIVE_MUTATION)
+	{
+		population_strategies[offspring_index] = next_gen_strategies[offspring_index];
+	}
+}
+
+/**
+ * add evaluated individuals to surrogate model
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::updateSurrogate(const T * const * indivs,
+		const double * fitness, size_t num_of_indivs)
+{
+	for(size_t i = 0; surrogate_modelP != NULL && i < num_of_indivs; i++)
+	{
+		surrogate_modelP->update(*(*(indivs + i)), fitness[i]);
+	}
+}
+
+/**
+ * start recording changes of an offspring (in a generation with delta evaluation)
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::beginChangeRecord(size_t offspring_index,
+		long long base_parent_index)
+{
+	if(!is_delta_generation)
+	{
+		return;
+	}
+	recording_changeP = &offspring_changes[offspring_index];
+	recording_changeP->reset(base_parent_index);
+}
+
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::recordChangeBase(const T & parent)
+{
+	if(recording_changeP == NULL)
+	{
+		return;
+	}
+
+	recording_changeP->parent_index = getStorageIndex(&parent);
+}
+
+/**
+ * index of an individual of population (they are in population storage at their index),
+ * -1 if it is not an individual of population
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+long long simple_ga<T, RandomEngine, Allocator>::getStorageIndex(const T * indivP)
+{
+	const less<const T *> is_before;
+	return !is_before(indivP, population_storage)
+			&& is_before(indivP, population_storage + population_capacity) ?
+			indivP - population_storage : -1;
+}
+
+/**
+ * strategy of each individual of initial population : initial strategy changed once
+ * (so that population starts with different strategies)
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::initStrategies()
+{
+	mutation_strategy initial_strategy;
+	initial_strategy.mutation_prob = MUTATION_PROBABILITY;
+	initial_strategy.step_size = MUTATION_STEP_SIZE;
+	population_strategies.assign(POPULATION_SIZE, initial_strategy);
+	next_gen_strategies.assign(POPULATION_SIZE, initial_strategy);
+	for(mutation_strategy & strategy : population_strategies)
+	{
+		adaptStrategy(strategy);
+	}
+}
+
+/**
+ * strategy of an offspring from strategies of its parents (crossover_parentsP) or
+ * of individual at its index (no crossover), changed for this offspring.
+ * It is used by mutation of offspring. Nothing is done without self-adaptive mutation.
  */
-template<typename T>
-void simple_ga<T>::run()
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::breedStrategy(size_t offspring_index,
+		const crossoverParents * crossover_parentsP)
 {
-	initializeRandomPopulation();
-
-	// atleast 2 indiv required
-	if(POPULATION_SIZE < 2)
+	if(!SELF_ADAPTIVE_MUTATION)
 	{
-		cerr<<"error cannot perform GA for population size < 2"<<endl;
 		return;
 	}
 
-	// allocate memory for next generation
-	T ** next_gen_population = new T * [ POPULATION_SIZE ];
-	for(size_t i = 0 ; i < POPULATION_SIZE; i++)
-	{
-		*(next_gen_population + i) = new T;
-	}
-
-	num_of_generations = 0;
-	T * next_gen_indivP = NULL;
-	while(!shouldStop())
+	mutation_strategy & strategy = next_gen_strategies[offspring_index];
+	strategy = population_strategies[offspring_index];
+	if(crossover_parentsP != NULL)
 	{
-		// create new individuals for next generation
-		for(size_t i = 0; i < POPULATION_SIZE; i++)
+		const long long index1 = getStorageIndex(crossover_parentsP->parent1);
+		const long long index2 = getStorageIndex(crossover_parentsP->parent2);
+		if(index1 >= 0 && index2 >= 0)
 		{
-			next_gen_indivP = *(next_gen_population + i);
-
-			*next_gen_indivP = _uniform_distribution_0_1(crossover_random_engine)
-				<= CROSSOVER_PROBABILITY
-				? crossOver(selectCrossOverParents())
-				: *(*(population + i));
-
-			tryMutation(*next_gen_indivP);
+			const mutation_strategy & strategy1 = population_strategies[index1];
+			const mutation_strategy & strategy2 = population_strategies[index2];
+			strategy.mutation_prob = (strategy1.mutation_prob + strategy2.mutation_prob)/2;
+			strategy.step_size = sqrt(strategy1.step_size*strategy2.step_size);
 		}
+	}
 
-		// copy new individuals as current population
-		// and update fitness values
-		copyNextGeneration(next_gen_population);
+	adaptStrategy(strategy);
+	mutating_strategyP = &strategy;
+}
 
-		num_of_generations++;
+/**
+ * log-normal change of step size and of odds of mutation probability
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::adaptStrategy(mutation_strategy & strategy)
+{
+	const double MIN_STEP_SIZE = 1e-12;
+	const double MIN_MUTATION_PROB = 0.001;
+	const double MAX_MUTATION_PROB = 0.999;
+	normal_distribution<double> normal_distribution_0_1(0, 1);
+
+	strategy.step_size = min(1.0, max(MIN_STEP_SIZE, strategy.step_size
+			*exp(MUTATION_LEARNING_RATE*normal_distribution_0_1(strategy_random_engine))));
+
+	const double prob = min(MAX_MUTATION_PROB, max(MIN_MUTATION_PROB, strategy.mutation_prob));
+	const double odds = prob/(1 - prob)
+			*exp(MUTATION_LEARNING_RATE*normal_distribution_0_1(strategy_random_engine));
+	strategy.mutation_prob = min(MAX_MUTATION_PROB, max(MIN_MUTATION_PROB, odds/(1 + odds)));
+}
 
-		// display best fitness for each generation
-		cout<<"generation : "<<num_of_generations
-				<<" best fitness : "<<best_fitness<<endl;
+/**
+ * fitness of an offspring from its base parent and its recorded changes,
+ * returns false if offspring must be fully evaluated
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+bool simple_ga<T, RandomEngine, Allocator>::getOffspringDeltaFitness(size_t offspring_index,
+		T * const * const next_genP, double & fitness)
+{
+	const genome_change & change = offspring_changes[offspring_index];
+	if(!change.isUsable())
+	{
+		return false;
 	}
 
-	// free memory for next generation
-	for(size_t i = 0 ; i < POPULATION_SIZE; i++)
+	// parent was swapped into next generation at its index,
+	// its fitness is not updated yet
+	const T & parent = *(*(next_genP + change.parent_index));
+	const double parent_fitness = fitness_mapP->find(*(population + change.parent_index))->second;
+	if(!getFitnessDelta(parent, parent_fitness, *(*(population + offspring_index)), change, fitness))
 	{
-		delete *(next_gen_population + i);
+		return false;
 	}
-
-	delete [ ] next_gen_population;
-
+	statistics.num_of_delta_evaluations++;
+	return true;
 }
 
-
-template<typename T>
-void simple_ga<T>::initializeRandomPopulation()
+/**
+ * calculate fitness of each individual with evaluation backend if it is set,
+ * individuals that backend could not evaluate (NaN fitness) are evaluated here.
+ * Without a backend, batched fitness of derived class is used if it has one.
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::evaluatePopulation(const T * const * indivs,
+		double * fitness, size_t num_of_indivs)
 {
-	// allocate memory if not initialized yet
-	if(population == NULL)
-	{
-		population = new T* [ POPULATION_SIZE ];
+	statistics.num_of_evaluations += num_of_indivs;
 
-		// initialize each member to a new T *
-		for(size_t i = 0 ; i < POPULATION_SIZE; i++)
+	if(fitness_evaluatorP != NULL)
+	{
+		fitness_evaluatorP->evaluate(indivs, fitness, num_of_indivs);
+	}
+	else if(evaluation_poolP)
+	{
+		// evaluate copies with evaluation threads (with deadline if it is set),
+		// submitting an individual only when a thread is free to start it
+		vector<async_evaluation> evaluations;
+		vector<size_t> evaluation_indices;
+		size_t next_index = 0;
+		for(size_t num_of_done = 0; num_of_done < num_of_indivs; num_of_done++)
 		{
-			*(population + i) = new T;
+			while(next_index < num_of_indivs && hasFreeEvaluationThread(evaluations.empty()))
+			{
+				evaluations.push_back(submitEvaluation(make_shared<T>(*(*(indivs + next_index)))));
+				evaluation_indices.push_back(next_index++);
+			}
+
+			double t_fitness;
+			const size_t k = waitForEvaluation(evaluations, t_fitness);
+			fitness[evaluation_indices[k]] = t_fitness;
+			evaluations.erase(evaluations.begin() + k);
+			evaluation_indices.erase(evaluation_indices.begin() + k);
 		}
+		return;
 	}
-
-	if(fitness_mapP == NULL)
+	else if(getBatchFitness(indivs, fitness, num_of_indivs))
 	{
-		fitness_mapP = new fitness_map_type;
+		return;
 	}
 
-	if(cumulative_mapP == NULL)
+	for(size_t i = 0; i < num_of_indivs; i++)
 	{
-		cumulative_mapP = new fitness_map_type;
+		if(fitness_evaluatorP == NULL || std::isnan(fitness[i]))
+		{
+			fitness[i] = getFitness(*(*(indivs + i)));
+		}
 	}
+}
 
-	T * indivP;
-	cout<<"generating random individuals.."<<endl;
-	for(size_t i = 0 ; i < POPULATION_SIZE; i++)
+/**
+ * reset statistics and stopping criterion at start of a run
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::resetStatistics()
+{
+	statistics = ga_statistics();
+	statistics.start_time = chrono::steady_clock::now();
+	if(stopping_criterion_ptr)
 	{
-		indivP = *(population + i);
-		*(indivP) = getRandomIndiv();
-		this->displayIndiv(*indivP);
+		stopping_criterion_ptr->reset();
 	}
+}
 
-	// initialize uniform distributions
-	_uniform_distribution_0_1 =
-		uniform_real_distribution<double> (0, 1);
+/**
+ * copy fitness values of current generation to statistics
+ * and note when best fitness improves
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::updateStatistics()
+{
+	statistics.num_of_generations = num_of_generations < 0 ? 0 : num_of_generations;
+	statistics.elapsed_seconds = chrono::duration<double>(
+			chrono::steady_clock::now() - statistics.start_time).count();
 
-	_uniform_pop_distribution =
-		uniform_int_distribution<int> (0, POPULATION_SIZE - 1);
+	if(best_fitness > statistics.best_fitness || statistics.best_fitness_evaluation == 0)
+	{
+		statistics.best_fitness_generation = statistics.num_of_generations;
+		statistics.best_fitness_evaluation = statistics.num_of_evaluations;
+		statistics.best_fitness_elapsed_seconds = statistics.elapsed_seconds;
+	}
 
+	statistics.best_fitness = best_fitness;
+	statistics.gen_best_fitness = gen_best_fitness;
+	statistics.avg_fitness = avg_fitness;
+	statistics.gen_min_fitness = gen_min_fitness;
 
-	fitness_sum = 0;
-	// initialize best and min fitness for this generation
-	gen_best_fitness = - DBL_MAX;
-	gen_min_fitness = DBL_MAX;
-	double t_fitness;
-	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	// variance is kept at 0 when rounding makes it slightly negative
+	statistics.diversity.fitness_variance =
+		max(0.0, fitness_square_sum/POPULATION_SIZE - avg_fitness*avg_fitness);
+}
+
+/**
+ * find diversity of current generation (if it is tracked).
+ * It is called once per generation, since it visits each individual.
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::updateDiversityStatistics()
+{
+	if(!TRACK_DIVERSITY)
 	{
-		indivP = *(population + i);
+		return;
+	}
 
-		t_fitness = getFitness(*indivP);
-		(*fitness_mapP)[indivP] = t_fitness;
+	diversity_statistics & diversity = statistics.diversity;
+	diversity.is_tracked = true;
+	diversity.num_of_unique_indivs = countUniqueIndivs(population, POPULATION_SIZE);
+	diversity.mean_distance = estimateMeanDistance(population, POPULATION_SIZE,
+			DIVERSITY_SAMPLE_PAIRS > 0 ? DIVERSITY_SAMPLE_PAIRS : POPULATION_SIZE,
+			diversity_random_engine);
+	diversity.mean_allele_entropy = meanAlleleEntropy(population, POPULATION_SIZE);
+}
 
-		fitness_sum += t_fitness;
-		updateCurrentGenMinMaxFitness(indivP, t_fitness);
+/**
+ * write statistics of current generation to telemetry (if it is set)
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::writeTelemetry()
+{
+	if(telemetry_writerP == NULL)
+	{
+		return;
 	}
 
-	best_fitness = gen_best_fitness;
-	best_individual = gen_best_individual;
-	avg_fitness = (double) fitness_sum/POPULATION_SIZE;
-
-	// set the cumulative fitness map
-	resetCumulativeMap();
+	telemetry_record record;
+	record.generation = statistics.num_of_generations;
+	record.num_of_evaluations = statistics.num_of_evaluations;
+	record.elapsed_seconds = statistics.elapsed_seconds;
+	record.best_fitness = best_fitness;
+	record.gen_best_fitness = gen_best_fitness;
+	record.avg_fitness = avg_fitness;
+	record.gen_min_fitness = gen_min_fitness;
+	record.fitness_sum = fitness_sum;
+	record.fitness_variance = statistics.diversity.fitness_variance;
+	telemetry_writerP->append(record);
 }
 
-
-template<typename T>
-void simple_ga<T>::copyNextGeneration(const T * const * const next_genP)
+/**
+ * display best fitness (and diversity if it is tracked) of current generation
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::displayGenerationProgress()
 {
-	// store last generation best fitness
-	const double prev_gen_best_fitness = gen_best_fitness;
-	const T prev_gen_best_individual = gen_best_individual;
+	if(!VERBOSE)
+	{
+		return;
+	}
 
-	// initialize best and min fitness for this generation
-	gen_best_fitness = - DBL_MAX;
-	gen_min_fitness = DBL_MAX;
+	cout<<"generation : "<<num_of_generations
+			<<" best fitness : "<<best_fitness;
 
-	double t_fitness;
-	T * indivP;
-	fitness_sum = 0;
-	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	if(statistics.diversity.is_tracked)
 	{
-		indivP = *(population + i);
-
-		*(indivP) = *( *(next_genP + i) );
-		t_fitness = getFitness(*indivP);
-		fitness_mapP->find(indivP)->second = t_fitness;
-		fitness_sum += t_fitness;
-		updateCurrentGenMinMaxFitness(indivP, t_fitness);
+		const diversity_statistics & diversity = statistics.diversity;
+		cout<<" fitness variance : "<<diversity.fitness_variance
+				<<" unique : "<<diversity.num_of_unique_indivs
+				<<" mean distance : "<<diversity.mean_distance;
+		if(!std::isnan(diversity.mean_allele_entropy))
+		{
+			cout<<" allele entropy : "<<diversity.mean_allele_entropy;
+		}
 	}
+	cout<<endl;
+}
 
-	// replace randomly selected individual with previous best individual
-	if(ELITISM)
+/**
+ * steady state GA with asynchronous evaluation :
+ * keep an offspring in evaluation for each evaluation thread, and
+ * add each offspring to population as soon as its evaluation finishes
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::runAsync()
+{
+	vector<async_evaluation> evaluations;
+	size_t num_of_generation_evaluations = 0;
+	double t_fitness;
+
+	num_of_generations = 0;
+	while(!shouldStop())
 	{
-		// generate a random index for replacement
-		int random_replacement_index =
-			_uniform_pop_distribution(replacement_random_engine);
+		// breed offspring for free evaluation threads (threads of expired evaluations
+		// are not free until those evaluations finish)
+		while(evaluations.size() < ASYNC_EVALUATION_THREADS
+				&& hasFreeEvaluationThread(evaluations.empty()))
+		{
+			shared_ptr<T> offspringP = make_shared<T>();
+			if(_uniform_distribution_0_1(crossover_random_engine) <= CROSSOVER_PROBABILITY)
+			{
+				crossOverInPlace(selectCrossOverParents(), *offspringP);
+			}
+			else
+			{
+				*offspringP = *selectAParent(NULL);
+			}
+			tryMutation(*offspringP);
 
-		T * const replacement_indivP = *(population + random_replacement_index);
-		const double replacement_indiv_fitness =
-			fitness_mapP->find(replacement_indivP)->second;
+			evaluations.push_back(submitEvaluation(offspringP));
+		}
 
-		// replace randomly selected individual with
-		// best known individual of previous generation
-		*replacement_indivP = prev_gen_best_individual;
-		fitness_mapP->find(replacement_indivP)->second = prev_gen_best_fitness;
+		// add first finished (or expired) offspring to population
+		const size_t index = waitForEvaluation(evaluations, t_fitness);
+		replaceIndividual(*evaluations[index].indivP, t_fitness);
+		evaluations.erase(evaluations.begin() + index);
+		statistics.num_of_evaluations++;
 
-		// adjust fitness sum for replaced individual
-		fitness_sum += prev_gen_best_fitness - replacement_indiv_fitness;
+		const bool is_generation_complete = ++num_of_generation_evaluations == POPULATION_SIZE;
+		if(is_generation_complete)
+		{
+			num_of_generation_evaluations = 0;
+			num_of_generations++;
+		}
+		updateStatistics();
 
-		// update max fitness if replaced
-		if(replacement_indiv_fitness == gen_best_fitness)
+		if(is_generation_complete)
 		{
-			indivP = *(population + 0);
-			double t_fitness = fitness_mapP->find(indivP)->second;
+			updateDiversityStatistics();
+			scratch_arena.reset();
 
-			gen_best_individual = *indivP;
-			gen_best_fitness = t_fitness;
+			// display best fitness for each generation
+			writeTelemetry();
+			displayGenerationProgress();
+		}
+	}
+}
 
-			for(size_t i = 1; i < POPULATION_SIZE; i++)
-			{
-				indivP= *(population + i);
-				t_fitness = fitness_mapP->find(indivP)->second;
+/**
+ * submit fitness calculation of an individual to evaluation threads,
+ * its deadline starts when a thread starts the calculation
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+typename simple_ga<T, RandomEngine, Allocator>::async_evaluation
+simple_ga<T, RandomEngine, Allocator>::submitEvaluation(const shared_ptr<T> & indivP)
+{
+	async_evaluation evaluation;
+	evaluation.indivP = indivP;
+	evaluation.deadlineP = make_shared<chrono::steady_clock::time_point>(
+			chrono::steady_clock::time_point::max());
+	{
+		lock_guard<mutex> lock(completion_mutex);
+		num_of_running_evaluations++;
+	}
 
-				if(t_fitness >= gen_best_fitness)
-				{
-					gen_best_individual = *indivP;
-					gen_best_fitness = t_fitness;
-				}
-			}
+	// fitness is set before notifying, so a waiting thread sees it as ready
+	shared_ptr<promise<double>> fitness_promiseP = make_shared<promise<double>>();
+	evaluation.fitness = fitness_promiseP->get_future();
+	const shared_ptr<chrono::steady_clock::time_point> deadlineP = evaluation.deadlineP;
+	evaluation_poolP->execute([this, indivP, fitness_promiseP, deadlineP]()
+	{
+		{
+			lock_guard<mutex> lock(completion_mutex);
+			*deadlineP = chrono::steady_clock::now()
+				+ chrono::milliseconds(max(EVALUATION_DEADLINE_MS, 0));
+			completion_condition.notify_all();
 		}
 
-		// update min fitness if replaced
-		if(replacement_indiv_fitness == gen_min_fitness)
-		{
-			indivP = *(population + 0);
-			double t_fitness = fitness_mapP->find(indivP)->second;
+		const double t_fitness = getFitness(*indivP);
 
-			gen_min_fitness = t_fitness;
+		lock_guard<mutex> lock(completion_mutex);
+		fitness_promiseP->set_value(t_fitness);
+		num_of_running_evaluations--;
+		completion_condition.notify_all();
+	});
 
-			for(size_t i = 1; i < POPULATION_SIZE; i++)
-			{
-				indivP= *(population + i);
-				t_fitness = fitness_mapP->find(indivP)->second;
+	return evaluation;
+}
 
-				if(t_fitness <= gen_min_fitness)
-				{
-					gen_min_fitness = t_fitness;
-				}
+/**
+ * returns true if an evaluation thread is free to start an evaluation,
+ * with should_wait it waits until a thread is free
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+bool simple_ga<T, RandomEngine, Allocator>::hasFreeEvaluationThread(bool should_wait)
+{
+	unique_lock<mutex> lock(completion_mutex);
+	while(should_wait && num_of_running_evaluations >= ASYNC_EVALUATION_THREADS)
+	{
+		completion_condition.wait(lock);
+	}
+	return num_of_running_evaluations < ASYNC_EVALUATION_THREADS;
+}
+
+/**
+ * wait until an evaluation finishes or passes its deadline,
+ * returns its index and sets its fitness (penalty fitness if deadline passed)
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+size_t simple_ga<T, RandomEngine, Allocator>::waitForEvaluation(
+		vector<async_evaluation> & evaluations, double & t_fitness)
+{
+	unique_lock<mutex> lock(completion_mutex);
+	while(true)
+	{
+		size_t earliest = 0;
+		for(size_t i = 0; i < evaluations.size(); i++)
+		{
+			if(evaluations[i].fitness.wait_for(chrono::seconds(0)) == future_status::ready)
+			{
+				t_fitness = evaluations[i].fitness.get();
+				return i;
+			}
+			if(*evaluations[i].deadlineP < *evaluations[earliest].deadlineP)
+			{
+				earliest = i;
 			}
 		}
 
+		// evaluations that have not started yet have no deadline
+		const chrono::steady_clock::time_point deadline = *evaluations[earliest].deadlineP;
+		if(EVALUATION_DEADLINE_MS <= 0 || deadline == chrono::steady_clock::time_point::max())
+		{
+			completion_condition.wait(lock);
+		}
+		else if(chrono::steady_clock::now() >= deadline)
+		{
+			// this evaluation keeps running, but its result is not used
+			t_fitness = PENALTY_FITNESS;
+			return earliest;
+		}
+		else
+		{
+			completion_condition.wait_until(lock, deadline);
+		}
+	}
+}
+
+/**
+ * replace worse of two randomly selected individuals with given individual
+ * (a best individual is never replaced, since there are two distinct candidates)
+ * and update fitness of population
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::replaceIndividual(const T & indiv, const double t_fitness)
+{
+	const size_t first_index = _uniform_pop_distribution(replacement_random_engine);
+	size_t second_index;
+	do
+	{
+		second_index = _uniform_pop_distribution(replacement_random_engine);
+	}
+	while(second_index == first_index);
+
+	T * const first_indivP = *(population + first_index);
+	T * const second_indivP = *(population + second_index);
+	const size_t replacement_index =
+		fitness_mapP->find(first_indivP)->second <= fitness_mapP->find(second_indivP)->second
+		? first_index : second_index;
+	T * const replacement_indivP = *(population + replacement_index);
+	const double replacement_indiv_fitness = fitness_mapP->find(replacement_indivP)->second;
+
+	*replacement_indivP = indiv;
+	fitness_mapP->find(replacement_indivP)->second = t_fitness;
+	fitness_sum += t_fitness - replacement_indiv_fitness;
+	fitness_square_sum += t_fitness*t_fitness
+			- replacement_indiv_fitness*replacement_indiv_fitness;
+
+	// find min and max fitness again if replaced individual had one of them
+	if(replacement_indiv_fitness == gen_min_fitness
+			|| replacement_indiv_fitness == gen_best_fitness)
+	{
+		findCurrentGenMinMaxFitness();
+	}
+	else
+	{
+		updateCurrentGenMinMaxFitness(replacement_index, t_fitness);
 	}
 
 	// update best known result so far
 	if(gen_best_fitness > best_fitness)
 	{
 		best_fitness = gen_best_fitness;
-		best_individual = gen_best_individual;
+		best_individual = *(*(population + gen_best_index));
 	}
 
 	avg_fitness = (double) fitness_sum/POPULATION_SIZE;
 
-	// reset cumulative fitness map for this population
+	// reset cumulative fitness map for changed population
 	resetCumulativeMap();
 }
 
-template<typename T>
-void simple_ga<T>::updateCurrentGenMinMaxFitness(const T * const indivP,
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::updateCurrentGenMinMaxFitness(size_t index,
 						const double t_fitness)
 {
 	if(t_fitness <= gen_min_fitness)
@@ -536,23 +2785,54 @@ void simple_ga<T>::updateCurrentGenMinMaxFitness(const T * const indivP,
 		gen_min_fitness = t_fitness;
 	}
 
+	// best individual is noted by its index, so it is not copied
 	if(t_fitness >= gen_best_fitness)
 	{
-		gen_best_individual = *indivP;
+		gen_best_index = index;
 		gen_best_fitness = t_fitness;
 	}
 }
 
-template<typename T>
-bool simple_ga<T>::resetCumulativeMap()
+/**
+ * find min and max fitness of current generation again from fitness map
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::findCurrentGenMinMaxFitness()
+{
+	gen_best_fitness = - DBL_MAX;
+	gen_min_fitness = DBL_MAX;
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		updateCurrentGenMinMaxFitness(i, fitness_mapP->find(*(population + i))->second);
+	}
+}
+
+template<typename T, typename RandomEngine, typename Allocator>
+bool simple_ga<T, RandomEngine, Allocator>::resetCumulativeMap()
 {
-	if(gen_min_fitness == gen_best_fitness)
+	// shift each fitness by min fitness, to make min fitness = 0 (total of shifted
+	// fitness is summed again, since fitness_sum is updated incrementally and its
+	// rounding errors can be larger than differences of nearly equal fitness values)
+	double total_shifted_fitness = 0;
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		total_shifted_fitness += fitness_mapP->find(*(population + i))->second - gen_min_fitness;
+	}
+
+	// fitness values that differ only by rounding (e.g. copies of a parent with
+	// a surrogate model) are taken as equal too
+	if(gen_min_fitness == gen_best_fitness || !(total_shifted_fitness > 0)
+			|| !std::isfinite(total_shifted_fitness))
 	{
-		cerr<<"generation : "<<num_of_generations
-			<<" both min & max fitness are equal"<<endl;
-		if(gen_min_fitness == 0)
+		// progress note only (not an error), so it is not displayed when verbose is off
+		if(VERBOSE)
 		{
-			cerr<<"generation : "<<num_of_generations<<" both min & max fitness is 0"<<endl;
+			cerr<<"generation : "<<num_of_generations
+				<<" both min & max fitness are equal"<<endl;
+			if(gen_min_fitness == 0)
+			{
+				cerr<<"generation : "<<num_of_generations<<" both min & max fitness is 0"<<endl;
+			}
 		}
 
 		// set each to equal in the cumulative map
@@ -568,10 +2848,6 @@ bool simple_ga<T>::resetCumulativeMap()
 	}
 	else
 	{
-		// shift each fitness by min fitness, to make min fitness = 0
-		// shift total_fitness by POPULATION_SIZE * min fitness
-		double total_shifted_fitness = fitness_sum - (POPULATION_SIZE*gen_min_fitness);
-
 		double shifted_fitness;
 		double relative_fitness;
 		double cum_relative_fitness = 0;
@@ -596,8 +2872,8 @@ bool simple_ga<T>::resetCumulativeMap()
 
 }
 
-template<typename T>
-typename simple_ga<T>::crossoverParents simple_ga<T>::selectCrossOverParents()
+template<typename T, typename RandomEngine, typename Allocator>
+typename simple_ga<T, RandomEngine, Allocator>::crossoverParents simple_ga<T, RandomEngine, Allocator>::selectCrossOverParents()
 {
 	crossoverParents crossoverParents;
 	crossoverParents.parent1 = selectAParent(NULL);
@@ -616,14 +2892,14 @@ typename simple_ga<T>::crossoverParents simple_ga<T>::selectCrossOverParents()
 	return crossoverParents;
 }
 
-template<typename T>
-T * simple_ga<T>::selectAParent(const T * const already_selectedP)
+template<typename T, typename RandomEngine, typename Allocator>
+T * simple_ga<T, RandomEngine, Allocator>::selectAParent(const T * const already_selectedP)
 {
 	return rouletteWheelSelection(already_selectedP);
 }
 
-template<typename T>
-T * simple_ga<T>::rouletteWheelSelection(const T * const already_selectedP)
+template<typename T, typename RandomEngine, typename Allocator>
+T * simple_ga<T, RandomEngine, Allocator>::rouletteWheelSelection(const T * const already_selectedP)
 {
 	T * parent = NULL, * indivP;
 	double random_value = _uniform_distribution_0_1(roulette_random_engine);
@@ -668,8 +2944,8 @@ T * simple_ga<T>::rouletteWheelSelection(const T * const already_selectedP)
  * find another individual whose fitness is
  * very close to fitness of this individual
  */
-template<typename T>
-T * simple_ga<T>::selectSimilarFit(const T * const indivP)
+template<typename T, typename RandomEngine, typename Allocator>
+T * simple_ga<T, RandomEngine, Allocator>::selectSimilarFit(const T * const indivP)
 {
 	const double indiv_fitness = fitness_mapP->find(indivP)->second;
 	// absolute fitness difference for each individual
@@ -699,22 +2975,29 @@ T * simple_ga<T>::selectSimilarFit(const T * const indivP)
 	return most_similar_indivP;
 }
 
-template<typename T>
-void simple_ga<T>::tryMutation(T & indiv)
+/**
+ * mutate an individual with mutation probability, returns true if it was mutated
+ */
+template<typename T, typename RandomEngine, typename Allocator>
+bool simple_ga<T, RandomEngine, Allocator>::tryMutation(T & indiv)
 {
-	if(_uniform_distribution_0_1(mutation_random_engine)
-			<= MUTATION_PROBABILITY)
+	// own probability of offspring with self-adaptive mutation
+	const double mutation_prob = mutating_strategyP != NULL ?
+			mutating_strategyP->mutation_prob : MUTATION_PROBABILITY;
+	if(_uniform_distribution_0_1(mutation_random_engine) <= mutation_prob)
 	{
 		// try mutation on this individual
 		this->mutate(indiv);
+		return true;
 	}
+	return false;
 }
 
 /**
  * displays results after GA run
  */
-template<typename T>
-void simple_ga<T>::displayResults()
+template<typename T, typename RandomEngine, typename Allocator>
+void simple_ga<T, RandomEngine, Allocator>::displayResults()
 {
 	if(num_of_generations < 0)
 	{
@@ -723,6 +3006,47 @@ void simple_ga<T>::displayResults()
 	}
 
 	cout<<endl<<"total number of generations - "<<num_of_generations<<endl;
+	cout<<"total number of evaluations - "<<statistics.num_of_evaluations<<endl;
+	if(ELIMINATE_DUPLICATES)
+	{
+		cout<<"duplicate offspring not evaluated - "
+				<<statistics.num_of_duplicate_offspring<<endl;
+		cout<<"duplicate offspring bred again - "
+				<<statistics.num_of_rebred_offspring<<endl;
+	}
+	// (with duplicate elimination they are counted as duplicates)
+	if(LAZY_EVALUATION && !ELIMINATE_DUPLICATES)
+	{
+		cout<<"unchanged offspring not evaluated - "<<statistics.num_of_unchanged_offspring<<endl;
+	}
+	if(FULL_EVALUATION_INTERVAL > 1)
+	{
+		cout<<"delta evaluations - "<<statistics.num_of_delta_evaluations<<endl;
+	}
+	if(surrogate_modelP != NULL)
+	{
+		cout<<"evaluations saved by surrogate - "
+				<<statistics.num_of_surrogate_saved_evaluations<<endl;
+	}
+	if(SELF_ADAPTIVE_MUTATION && !population_strategies.empty())
+	{
+		double prob_sum = 0;
+		double log_step_sum = 0;
+		for(const mutation_strategy & strategy : population_strategies)
+		{
+			prob_sum += strategy.mutation_prob;
+			log_step_sum += log(strategy.step_size);
+		}
+		cout<<"mean mutation probability of population - "
+				<<prob_sum/population_strategies.size()<<endl;
+		cout<<"geometric mean mutation step size of population - "
+				<<exp(log_step_sum/population_strategies.size())<<endl;
+	}
+	if(LOCAL_SEARCH_ELITES > 0)
+	{
+		cout<<"local searches (improved) - "<<statistics.num_of_local_searches
+				<<" ("<<statistics.num_of_local_search_improvements<<")"<<endl;
+	}
 	double best_fitness = getFitness(best_individual);
 	if(best_fitness != this->best_fitness)
 	{
@@ -741,6 +3065,23 @@ void simple_ga<T>::displayResults()
 }
 
 // end of definitions
+
+/**
+ * PRE-INSTANTIATED GENETIC ALGORITHMS
+ * ===================================
+ * With GA_CORE_LIBRARY defined (by linking "ga_core" library, see src/core/ga_core.cpp),
+ * simple_ga of these common genome types is compiled once in ga_core, instead of in
+ * every translation unit that uses it. vector<bool> is the bit-packed genome.
+ *
+ */
+#ifdef GA_CORE_LIBRARY
+extern template class simple_ga<vector<int>>;
+extern template class simple_ga<vector<int>, xoshiro256ss>;
+extern template class simple_ga<vector<double>>;
+extern template class simple_ga<vector<double>, xoshiro256ss>;
+extern template class simple_ga<vector<bool>>;
+extern template class simple_ga<vector<bool>, xoshiro256ss>;
+#endif
 }
 #endif /* GA_H_ */
 
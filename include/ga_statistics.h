@@ -0,0 +1,95 @@
+/*
+ * ga_statistics.h
+ * Statistics of a GA run
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef GA_STATISTICS_H_
+#define GA_STATISTICS_H_
+
+#include <chrono>
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * DIVERSITY STATISTICS (diversity_statistics)
+ * ===========================================
+ * Diversity of a generation (see "diversity.h").
+ *
+ */
+struct diversity_statistics
+{
+	// false if diversity is not tracked
+	bool is_tracked = false;
+
+	// variance of fitness values
+	double fitness_variance = 0;
+	// number of distinct individuals
+	size_t num_of_unique_indivs = 0;
+	// mean distance between two individuals (estimated from random pairs)
+	double mean_distance = 0;
+	// mean entropy (in bits) of alleles at each position
+	// (only for individuals that are vectors of integers, otherwise NaN)
+	double mean_allele_entropy = 0;
+};
+
+
+/**
+ * GA STATISTICS (ga_statistics)
+ * =============================
+ * Statistics of a GA run, updated by GA after each generation.
+ * Each value is maintained incrementally, so reading it costs O(1).
+ *
+ */
+struct ga_statistics
+{
+	// number of completed generations
+	long long num_of_generations = 0;
+	// number of fitness calculations (including initial population)
+	unsigned long long num_of_evaluations = 0;
+
+	// best known so far
+	double best_fitness = 0;
+	// current generation best, average and minimum fitness
+	double gen_best_fitness = 0;
+	double avg_fitness = 0;
+	double gen_min_fitness = 0;
+
+	// offspring that were not evaluated since they duplicated another individual,
+	// and offspring that were bred again for being duplicates
+	unsigned long long num_of_duplicate_offspring = 0;
+	unsigned long long num_of_rebred_offspring = 0;
+
+	// offspring that were unchanged copies of their parents (kept fitness of parent)
+	unsigned long long num_of_unchanged_offspring = 0;
+
+	// offspring whose fitness was calculated from their base parent (delta evaluation),
+	// they are not counted in num_of_evaluations
+	unsigned long long num_of_delta_evaluations = 0;
+
+	// offspring that surrogate model screened out (replaced by their parent, not evaluated)
+	unsigned long long num_of_surrogate_saved_evaluations = 0;
+
+	// local searches of memetic mode, and how many of them improved fitness
+	unsigned long long num_of_local_searches = 0;
+	unsigned long long num_of_local_search_improvements = 0;
+
+	// generation and evaluation in which best fitness was last improved
+	long long best_fitness_generation = 0;
+	unsigned long long best_fitness_evaluation = 0;
+
+	// time since start of GA run, and when best fitness was last improved
+	double elapsed_seconds = 0;
+	double best_fitness_elapsed_seconds = 0;
+	chrono::steady_clock::time_point start_time;
+
+	// diversity of current generation (only if diversity is tracked)
+	diversity_statistics diversity;
+};
+}
+
+#endif /* GA_STATISTICS_H_ */
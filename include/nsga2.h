@@ -0,0 +1,641 @@
+/*
+ * nsga2.h
+ * A multi-objective Genetic Algorithm (NSGA-II) built on simple_ga.
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#ifndef NSGA2_H_
+#define NSGA2_H_
+
+#include <algorithm>
+#include <limits>
+#include "ga.h"
+
+using namespace std;
+
+namespace ga
+{
+
+/**
+ * NON-DOMINATED SORTING GENETIC ALGORITHM II (nsga2_ga)
+ * =====================================================
+ * It evolves a set of trade-off solutions (Pareto front) for problems with
+ * more than one objective, instead of a single best solution.
+ * It reuses crossover and mutation contract of simple_ga, only fitness is replaced
+ * by a vector of objective values.
+ *
+ * FUNCTION MAXIMIZATION
+ * Each objective is maximized (same as fitness in simple_ga).
+ * Objectives to be minimized should use a negative value.
+ *
+ * NON-DOMINATED SORTING
+ * Efficient non-dominated sort with binary search (ENS-BS). Individuals are sorted
+ * by their objectives and then each one is placed in the first front where no member
+ * dominates it. For two objectives only the last member of a front needs to be checked,
+ * which makes the sort O(N log N).
+ *
+ * PARENT SELECTION
+ * Binary tournament on (front rank, crowding distance).
+ *
+ * SURVIVOR SELECTION
+ * Parents and offspring are combined, and fronts are taken in order of rank.
+ * Last front that does not fit completely is truncated by crowding distance.
+ *
+ * PARETO ARCHIVE
+ * Non-dominated individuals found so far (with unique objective values), truncated
+ * by crowding distance when it exceeds the maximum archive size.
+ *
+ */
+
+/**
+ * --- PURE VIRTUAL METHODS TO IMPLEMENT ---
+ * =========================================
+ * Following methods must be implemented in derived class after parameter instantiation:
+ * 1. T getRandomIndiv() - generate a random individual
+ * 2. void displayIndiv(const T & indiv) - display an individual
+ * 3. void getObjectives(const T & indiv, vector<double> & objectives) - objective values
+ * 4. T crossOver(const crossoverParents & crossoverParents) - create an offspring from two parents
+ * 5. void mutate(T & indiv) - mutate an individual
+ *
+ */
+
+/**
+ * returns true if first objective vector dominates the second one
+ * (no worse in all objectives and better in at least one)
+ */
+inline bool dominates(const double * objectives1, const double * objectives2,
+		size_t num_of_objectives)
+{
+	bool better = false;
+	for(size_t m = 0; m < num_of_objectives; m++)
+	{
+		if(objectives1[m] < objectives2[m])
+		{
+			return false;
+		}
+		if(objectives1[m] > objectives2[m])
+		{
+			better = true;
+		}
+	}
+	return better;
+}
+
+/**
+ * sort individuals into non-dominated fronts (ENS-BS).
+ * objectives - row major values (num_of_indivs x num_of_objectives)
+ * rank - front rank of each individual (0 is the non-dominated front)
+ * returns indices of individuals in each front
+ */
+inline vector<vector<size_t>> nonDominatedSort(const double * objectives,
+		size_t num_of_indivs, size_t num_of_objectives, vector<size_t> & rank)
+{
+	vector<size_t> sorted(num_of_indivs);
+	for(size_t i = 0; i < num_of_indivs; i++)
+	{
+		sorted[i] = i;
+	}
+
+	// lexicographic order with larger values first, so an individual
+	// can only be dominated by individuals placed before it
+	sort(sorted.begin(), sorted.end(),
+		[objectives, num_of_objectives](size_t a, size_t b)
+		{
+			const double * a_objectives = objectives + a*num_of_objectives;
+			const double * b_objectives = objectives + b*num_of_objectives;
+			for(size_t m = 0; m < num_of_objectives; m++)
+			{
+				if(a_objectives[m] != b_objectives[m])
+				{
+					return a_objectives[m] > b_objectives[m];
+				}
+			}
+			return a < b;
+		});
+
+	// check if any member of a front dominates an individual
+	auto isDominatedBy = [objectives, num_of_objectives](const vector<size_t> & front,
+			size_t indiv) -> bool
+	{
+		const double * indiv_objectives = objectives + indiv*num_of_objectives;
+
+		// members of a two objective front are in increasing order of second objective
+		// so the last member is the only one that can dominate
+		if(num_of_objectives == 2)
+		{
+			return dominates(objectives + front.back()*num_of_objectives,
+					indiv_objectives, num_of_objectives);
+		}
+
+		// recently added members are most similar, so check them first
+		for(size_t k = front.size(); k > 0; k--)
+		{
+			if(dominates(objectives + front[k - 1]*num_of_objectives,
+					indiv_objectives, num_of_objectives))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	vector<vector<size_t>> fronts;
+	rank.assign(num_of_indivs, 0);
+	for(size_t indiv : sorted)
+	{
+		// binary search for the first front that does not dominate this individual
+		size_t low = 0, high = fronts.size();
+		while(low < high)
+		{
+			size_t mid = low + (high - low)/2;
+			if(isDominatedBy(fronts[mid], indiv))
+			{
+				low = mid + 1;
+			}
+			else
+			{
+				high = mid;
+			}
+		}
+
+		if(low == fronts.size())
+		{
+			fronts.push_back(vector<size_t>());
+		}
+		fronts[low].push_back(indiv);
+		rank[indiv] = low;
+	}
+
+	return fronts;
+}
+
+/**
+ * set crowding distance of each member of a front
+ * (boundary members of each objective get an infinite distance)
+ */
+inline void assignCrowdingDistance(const vector<size_t> & front, const double * objectives,
+		size_t num_of_objectives, vector<double> & crowding_distance)
+{
+	for(size_t indiv : front)
+	{
+		crowding_distance[indiv] = 0;
+	}
+
+	if(front.size() < 3)
+	{
+		for(size_t indiv : front)
+		{
+			crowding_distance[indiv] = numeric_limits<double>::infinity();
+		}
+		return;
+	}
+
+	vector<size_t> sorted(front);
+	for(size_t m = 0; m < num_of_objectives; m++)
+	{
+		sort(sorted.begin(), sorted.end(),
+			[objectives, num_of_objectives, m](size_t a, size_t b)
+			{
+				return objectives[a*num_of_objectives + m] < objectives[b*num_of_objectives + m];
+			});
+
+		const double min_value = objectives[sorted.front()*num_of_objectives + m];
+		const double max_value = objectives[sorted.back()*num_of_objectives + m];
+
+		crowding_distance[sorted.front()] = numeric_limits<double>::infinity();
+		crowding_distance[sorted.back()] = numeric_limits<double>::infinity();
+
+		if(max_value == min_value)
+		{
+			continue;
+		}
+
+		for(size_t k = 1; k + 1 < sorted.size(); k++)
+		{
+			crowding_distance[sorted[k]] +=
+				(objectives[sorted[k + 1]*num_of_objectives + m]
+				 - objectives[sorted[k - 1]*num_of_objectives + m])/(max_value - min_value);
+		}
+	}
+}
+
+
+template <typename T, typename RandomEngine = mt19937>
+class nsga2_ga : public simple_ga<T, RandomEngine>
+{
+public :
+	/**
+	 * run multi-objective genetic algorithm
+	 */
+	void run() override;
+
+	/**
+	 * displays Pareto archive after GA run
+	 */
+	void displayResults() override;
+
+	/**
+	 * optional method for changing maximum size of Pareto archive
+	 */
+	void setArchiveSize(size_t archive_size)
+	{
+		ARCHIVE_SIZE = archive_size;
+	}
+
+	/**
+	 * returns non-dominated individuals found so far
+	 */
+	const vector<T> & getParetoFront()
+	{
+		return archive;
+	}
+
+	/**
+	 * returns objective values of non-dominated individuals found so far
+	 * (in the same order as getParetoFront)
+	 */
+	const vector<vector<double>> & getParetoObjectives()
+	{
+		return archive_objectives;
+	}
+
+protected:
+	typedef typename simple_ga<T, RandomEngine>::crossoverParents crossoverParents;
+	typedef typename simple_ga<T, RandomEngine>::random_engine_type random_engine_type;
+
+	size_t NUM_OF_OBJECTIVES = 2;
+	size_t ARCHIVE_SIZE = 1000;
+
+	/**
+	 * --- METHODS TO OVERRIDE IN DERIVED CLASS ---
+	 * --------------------------------------------
+	 */
+	// calculate value of each objective for individual
+	// (objectives has NUM_OF_OBJECTIVES elements)
+	virtual void getObjectives(const T & indiv, vector<double> & objectives) = 0;
+
+	/**
+	 * scalar fitness is not used by multi-objective GA,
+	 * value of first objective is returned
+	 */
+	double getFitness(const T & indiv) override
+	{
+		vector<double> objectives(NUM_OF_OBJECTIVES);
+		getObjectives(indiv, objectives);
+		return objectives[0];
+	}
+
+	// create random engines of multi-objective GA
+	void initRandomEngines() override
+	{
+		tournament_random_engine = this->nextRandomStream();
+		crossover_random_engine = this->nextRandomStream();
+	}
+
+	explicit nsga2_ga(size_t num_of_objectives)
+	{
+		if(num_of_objectives >= 2)
+		{
+			NUM_OF_OBJECTIVES = num_of_objectives;
+		}
+		else
+		{
+			cerr<<"error number of objectives : "<<num_of_objectives<<
+					" (at least 2 are required). keeping default "<<NUM_OF_OBJECTIVES<<endl;
+		}
+		nsga2_ga::initRandomEngines();
+	}
+
+private:
+	// parents (first half) and offspring (second half)
+	vector<T> combined_population;
+	// objective values of combined population (row major)
+	vector<double> combined_objectives;
+	vector<size_t> rank;
+	vector<double> crowding_distance;
+	// objective values of a single individual
+	vector<double> objectives_buffer;
+
+	// non-dominated individuals found so far
+	vector<T> archive;
+	vector<vector<double>> archive_objectives;
+
+	// parent selection random engine
+	random_engine_type tournament_random_engine;
+	// crossover random engine
+	random_engine_type crossover_random_engine;
+
+	uniform_real_distribution<double> _uniform_distribution_0_1 {0, 1};
+
+	void evaluate(size_t index);
+	void sortCombinedPopulation(size_t num_of_indivs);
+	void selectSurvivors();
+	void updateArchive();
+	size_t tournamentSelection(size_t already_selected);
+};
+
+/**
+ * IMPLEMENTATION OF METHODS OF CLASS "nsga2_ga<T, RandomEngine>"
+ * ==============================================================
+ */
+
+template<typename T, typename RandomEngine>
+void nsga2_ga<T, RandomEngine>::run()
+{
+	const size_t POPULATION_SIZE = this->POPULATION_SIZE;
+	if(POPULATION_SIZE < 2)
+	{
+		cerr<<"error cannot perform GA for population size < 2"<<endl;
+		return;
+	}
+
+	this->resetStatistics();
+	combined_population.assign(2*POPULATION_SIZE, T());
+	combined_objectives.assign(2*POPULATION_SIZE*NUM_OF_OBJECTIVES, 0);
+	archive.clear();
+	archive_objectives.clear();
+
+	if(this->VERBOSE)
+	{
+		cout<<"generating random individuals.."<<endl;
+	}
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		combined_population[i] = this->getRandomIndiv();
+		evaluate(i);
+	}
+	sortCombinedPopulation(POPULATION_SIZE);
+	updateArchive();
+
+	this->num_of_generations = 0;
+	while(!this->shouldStop())
+	{
+		// create offspring in second half of combined population
+		for(size_t i = POPULATION_SIZE; i < 2*POPULATION_SIZE; i++)
+		{
+			const size_t parent1 = tournamentSelection(POPULATION_SIZE);
+			bool is_dirty = true;
+			if(_uniform_distribution_0_1(crossover_random_engine)
+					<= this->CROSSOVER_PROBABILITY)
+			{
+				crossoverParents crossover_parents;
+				crossover_parents.parent1 = &combined_population[parent1];
+				crossover_parents.parent2 = &combined_population[tournamentSelection(parent1)];
+				this->crossOverInPlace(crossover_parents, combined_population[i]);
+			}
+			else
+			{
+				combined_population[i] = combined_population[parent1];
+				is_dirty = false;
+			}
+
+			if(this->tryMutation(combined_population[i]))
+			{
+				is_dirty = true;
+			}
+
+			// an unchanged copy keeps objectives of its parent (lazy evaluation)
+			if(!is_dirty && this->LAZY_EVALUATION)
+			{
+				copy(combined_objectives.begin() + parent1*NUM_OF_OBJECTIVES,
+						combined_objectives.begin() + (parent1 + 1)*NUM_OF_OBJECTIVES,
+						combined_objectives.begin() + i*NUM_OF_OBJECTIVES);
+				this->statistics.num_of_unchanged_offspring++;
+			}
+			else
+			{
+				evaluate(i);
+			}
+		}
+
+		sortCombinedPopulation(2*POPULATION_SIZE);
+		selectSurvivors();
+		updateArchive();
+
+		this->num_of_generations++;
+		this->updateStatistics();
+		this->scratch_arena.reset();
+
+		// display size of Pareto front for each generation
+		if(this->VERBOSE)
+		{
+			cout<<"generation : "<<this->num_of_generations
+					<<" pareto front size : "<<archive.size()<<endl;
+		}
+	}
+}
+
+/**
+ * calculate objectives of an individual in combined population
+ */
+template<typename T, typename RandomEngine>
+void nsga2_ga<T, RandomEngine>::evaluate(size_t index)
+{
+	this->statistics.num_of_evaluations++;
+	objectives_buffer.assign(NUM_OF_OBJECTIVES, 0);
+	getObjectives(combined_population[index], objectives_buffer);
+	copy(objectives_buffer.begin(), objectives_buffer.end(),
+			combined_objectives.begin() + index*NUM_OF_OBJECTIVES);
+}
+
+/**
+ * set rank and crowding distance for first num_of_indivs
+ * individuals of combined population
+ */
+template<typename T, typename RandomEngine>
+void nsga2_ga<T, RandomEngine>::sortCombinedPopulation(size_t num_of_indivs)
+{
+	vector<vector<size_t>> fronts = nonDominatedSort(combined_objectives.data(),
+			num_of_indivs, NUM_OF_OBJECTIVES, rank);
+
+	crowding_distance.assign(num_of_indivs, 0);
+	for(const vector<size_t> & front : fronts)
+	{
+		assignCrowdingDistance(front, combined_objectives.data(),
+				NUM_OF_OBJECTIVES, crowding_distance);
+	}
+}
+
+/**
+ * move best half of combined population (by rank, then by crowding distance)
+ * to first half of combined population
+ */
+template<typename T, typename RandomEngine>
+void nsga2_ga<T, RandomEngine>::selectSurvivors()
+{
+	const size_t POPULATION_SIZE = this->POPULATION_SIZE;
+	const size_t total = 2*POPULATION_SIZE;
+
+	vector<size_t> order(total);
+	for(size_t i = 0; i < total; i++)
+	{
+		order[i] = i;
+	}
+
+	auto isBetter = [this](size_t a, size_t b)
+	{
+		if(rank[a] != rank[b])
+		{
+			return rank[a] < rank[b];
+		}
+		return crowding_distance[a] > crowding_distance[b];
+	};
+	nth_element(order.begin(), order.begin() + POPULATION_SIZE, order.end(), isBetter);
+
+	vector<T> survivors;
+	survivors.reserve(total);
+	vector<double> survivor_objectives(total*NUM_OF_OBJECTIVES);
+	vector<size_t> survivor_rank(total);
+	vector<double> survivor_crowding_distance(total);
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		const size_t survivor = order[i];
+		survivors.push_back(std::move(combined_population[survivor]));
+		copy(combined_objectives.begin() + survivor*NUM_OF_OBJECTIVES,
+				combined_objectives.begin() + (survivor + 1)*NUM_OF_OBJECTIVES,
+				survivor_objectives.begin() + i*NUM_OF_OBJECTIVES);
+		survivor_rank[i] = rank[survivor];
+		survivor_crowding_distance[i] = crowding_distance[survivor];
+	}
+	survivors.resize(total);
+
+	combined_population.swap(survivors);
+	combined_objectives.swap(survivor_objectives);
+	rank.swap(survivor_rank);
+	crowding_distance.swap(survivor_crowding_distance);
+}
+
+/**
+ * add non-dominated individuals of current population to Pareto archive
+ */
+template<typename T, typename RandomEngine>
+void nsga2_ga<T, RandomEngine>::updateArchive()
+{
+	const size_t POPULATION_SIZE = this->POPULATION_SIZE;
+
+	// candidates are current archive and first front of population
+	vector<const T *> candidates;
+	vector<double> candidate_objectives;
+	for(size_t i = 0; i < archive.size(); i++)
+	{
+		candidates.push_back(&archive[i]);
+		candidate_objectives.insert(candidate_objectives.end(),
+				archive_objectives[i].begin(), archive_objectives[i].end());
+	}
+	for(size_t i = 0; i < POPULATION_SIZE; i++)
+	{
+		if(rank[i] == 0)
+		{
+			candidates.push_back(&combined_population[i]);
+			candidate_objectives.insert(candidate_objectives.end(),
+					combined_objectives.begin() + i*NUM_OF_OBJECTIVES,
+					combined_objectives.begin() + (i + 1)*NUM_OF_OBJECTIVES);
+		}
+	}
+
+	vector<size_t> candidate_rank;
+	vector<vector<size_t>> fronts = nonDominatedSort(candidate_objectives.data(),
+			candidates.size(), NUM_OF_OBJECTIVES, candidate_rank);
+
+	// keep only one individual for equal objective values
+	// (members of a front are in lexicographic order, so equal values are adjacent)
+	vector<size_t> non_dominated;
+	for(size_t candidate : fronts[0])
+	{
+		if(non_dominated.empty() || !equal(
+				candidate_objectives.begin() + candidate*NUM_OF_OBJECTIVES,
+				candidate_objectives.begin() + (candidate + 1)*NUM_OF_OBJECTIVES,
+				candidate_objectives.begin() + non_dominated.back()*NUM_OF_OBJECTIVES))
+		{
+			non_dominated.push_back(candidate);
+		}
+	}
+
+	// truncate most crowded members
+	if(non_dominated.size() > ARCHIVE_SIZE)
+	{
+		vector<double> candidate_crowding_distance(candidates.size());
+		assignCrowdingDistance(non_dominated, candidate_objectives.data(),
+				NUM_OF_OBJECTIVES, candidate_crowding_distance);
+		nth_element(non_dominated.begin(), non_dominated.begin() + ARCHIVE_SIZE,
+			non_dominated.end(),
+			[&candidate_crowding_distance](size_t a, size_t b)
+			{
+				return candidate_crowding_distance[a] > candidate_crowding_distance[b];
+			});
+		non_dominated.resize(ARCHIVE_SIZE);
+	}
+
+	vector<T> next_archive;
+	vector<vector<double>> next_archive_objectives;
+	next_archive.reserve(non_dominated.size());
+	next_archive_objectives.reserve(non_dominated.size());
+	for(size_t candidate : non_dominated)
+	{
+		next_archive.push_back(*candidates[candidate]);
+		next_archive_objectives.push_back(vector<double>(
+				candidate_objectives.begin() + candidate*NUM_OF_OBJECTIVES,
+				candidate_objectives.begin() + (candidate + 1)*NUM_OF_OBJECTIVES));
+	}
+
+	archive.swap(next_archive);
+	archive_objectives.swap(next_archive_objectives);
+}
+
+/**
+ * binary tournament among current population (first half of combined population),
+ * lower rank wins and for equal rank larger crowding distance wins
+ */
+template<typename T, typename RandomEngine>
+size_t nsga2_ga<T, RandomEngine>::tournamentSelection(size_t already_selected)
+{
+	const size_t POPULATION_SIZE = this->POPULATION_SIZE;
+	uniform_int_distribution<size_t> distrib_indiv(0, POPULATION_SIZE - 1);
+
+	size_t indiv1, indiv2;
+	do
+	{
+		indiv1 = distrib_indiv(tournament_random_engine);
+		indiv2 = distrib_indiv(tournament_random_engine);
+	}
+	while(indiv1 == already_selected || indiv2 == already_selected);
+
+	if(rank[indiv1] != rank[indiv2])
+	{
+		return rank[indiv1] < rank[indiv2] ? indiv1 : indiv2;
+	}
+	return crowding_distance[indiv1] >= crowding_distance[indiv2] ? indiv1 : indiv2;
+}
+
+/**
+ * displays Pareto archive after GA run
+ */
+template<typename T, typename RandomEngine>
+void nsga2_ga<T, RandomEngine>::displayResults()
+{
+	if(this->num_of_generations < 0)
+	{
+		cerr<<"error values not initialized to display any result"<<endl;
+		return;
+	}
+
+	cout<<endl<<"total number of generations - "<<this->num_of_generations<<endl;
+	cout<<"pareto front size - "<<archive.size()<<endl;
+	for(size_t i = 0; i < archive.size(); i++)
+	{
+		cout<<"objectives -";
+		for(double objective : archive_objectives[i])
+		{
+			cout<<" "<<objective;
+		}
+		cout<<endl<<"indiv - "<<endl;
+		this->displayIndiv(archive[i]);
+	}
+}
+
+// end of definitions
+}
+#endif /* NSGA2_H_ */
@@ -0,0 +1,426 @@
+/*
+ * parameter_tuner.h
+ * Races parameter sets of a GA (successive halving) to minimize time to target
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef PARAMETER_TUNER_H_
+#define PARAMETER_TUNER_H_
+
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <cmath>
+#include <float.h>
+#include "batch_runner.h"
+#include "stopping_criteria.h"
+#include "util/random_engines.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * parameters of setParameters that are tuned
+ */
+struct ga_parameters
+{
+	long long population_size = 100;
+	double crossover_prob = 0.9;
+	double mutation_prob = 0.1;
+	double allele_mutation_prob = 0.03;
+
+	string toString() const
+	{
+		ostringstream out;
+		out<<"population "<<population_size<<", crossover "<<crossover_prob
+				<<", mutation "<<mutation_prob<<", allele mutation "<<allele_mutation_prob;
+		return out.str();
+	}
+};
+
+/**
+ * ranges from which random parameter sets are drawn
+ * (population size log-uniformly, probabilities uniformly)
+ */
+struct ga_parameter_space
+{
+	long long min_population_size = 20;
+	long long max_population_size = 500;
+	double min_crossover_prob = 0.5;
+	double max_crossover_prob = 1.0;
+	double min_mutation_prob = 0.01;
+	double max_mutation_prob = 0.5;
+	double min_allele_mutation_prob = 0.005;
+	double max_allele_mutation_prob = 0.1;
+};
+
+/**
+ * cost of a parameter set to be minimized
+ */
+enum tuning_objective { TUNE_EVALUATIONS_TO_TARGET, TUNE_TIME_TO_TARGET };
+
+/**
+ * result of a parameter set in one round of the race
+ */
+struct tuning_result
+{
+	size_t candidate = 0;
+	size_t round = 0;
+	unsigned long long evaluation_budget = 0;
+	size_t num_of_runs = 0;
+	size_t num_of_runs_reached = 0;
+	// mean cost of runs (PAR2, see parameter_tuner)
+	double score = DBL_MAX;
+	double median_fitness = NAN;
+	bool is_eliminated = false;
+};
+
+/**
+ * PARAMETER TUNER (parameter_tuner)
+ * =================================
+ * Finds population size, crossover, mutation and allele mutation probabilities of a GA
+ * that reach a target fitness with fewest evaluations (or in least time), by racing
+ * candidate parameter sets with successive halving :
+ *
+ * ROUND 0 - every candidate is run with each seed (same seeds for all candidates), and
+ * each run stops at target fitness or when MIN_EVALUATION_BUDGET evaluations are used.
+ *
+ * ROUND r - best 1/ELIMINATION_RATE of candidates (at least one) survive, and are run
+ * again with ELIMINATION_RATE times the budget of previous round.
+ *
+ * Race ends when one candidate is left or the budget would exceed MAX_EVALUATION_BUDGET
+ * (then best candidate of last round wins).
+ * So bad parameter sets are stopped after a small budget, and most of the time is spent
+ * on good ones.
+ *
+ * Score of a candidate is mean cost of its runs (PAR2) : evaluations (or seconds) to
+ * reach target, or twice the evaluations (or seconds) used by a run that did not reach it.
+ * Equal scores (e.g. no run reached target) are ordered by median best fitness.
+ *
+ * Runs of a round are done in parallel on a batch_runner (one thread per run). Factory
+ * returns a new GA for the problem, tuner sets its parameters (max generations are
+ * unlimited, elitism is on) and stopping criterion.
+ *
+ * --- EXAMPLE ---
+ * parameter_tuner tuner(thread::hardware_concurrency(), 0);
+ * tuner.addRandomCandidates(ga_parameter_space(), 16, 1);
+ * ga_parameters best = tuner.tune([]() { return new nqueen_genetic_algo(30); });
+ * tuner.writeBestParameters(cout);
+ *
+ */
+class parameter_tuner
+{
+public :
+	parameter_tuner(unsigned num_of_threads, double target_fitness) :
+		NUM_OF_THREADS(max(1u, num_of_threads)), TARGET_FITNESS(target_fitness)
+	{
+	}
+
+	/**
+	 * cost to minimize (default : evaluations to target)
+	 */
+	void setObjective(tuning_objective objective)
+	{
+		OBJECTIVE = objective;
+	}
+
+	/**
+	 * seeds run for each candidate in each round (first_seed, first_seed + 1, ...)
+	 */
+	void setSeeds(size_t num_of_seeds, uint64_t first_seed = 1);
+
+	/**
+	 * budget of first round, maximum budget of a round, and fraction of candidates
+	 * (1/elimination_rate) kept after each round
+	 */
+	void setRace(unsigned long long min_evaluation_budget,
+			unsigned long long max_evaluation_budget, unsigned elimination_rate = 2);
+
+	void addCandidate(const ga_parameters & parameters)
+	{
+		candidates.push_back(parameters);
+	}
+
+	/**
+	 * add num_of_candidates random parameter sets from given ranges
+	 */
+	void addRandomCandidates(const ga_parameter_space & space, size_t num_of_candidates,
+			uint64_t seed);
+
+	/**
+	 * race all candidates and return best parameter set
+	 */
+	template<typename Factory>
+	ga_parameters tune(Factory factory);
+
+	const vector<ga_parameters> & getCandidates()
+	{
+		return candidates;
+	}
+
+	/**
+	 * result of each candidate in each round it was run
+	 */
+	const vector<tuning_result> & getResults()
+	{
+		return results;
+	}
+
+	/**
+	 * best parameter set and its score as JSON
+	 */
+	void writeBestParameters(ostream & out);
+
+	/**
+	 * results of all rounds as CSV (with header)
+	 */
+	void writeCsv(ostream & out);
+
+private:
+	const unsigned NUM_OF_THREADS;
+	const double TARGET_FITNESS;
+	tuning_objective OBJECTIVE = TUNE_EVALUATIONS_TO_TARGET;
+
+	size_t NUM_OF_SEEDS = 5;
+	uint64_t FIRST_SEED = 1;
+	unsigned long long MIN_EVALUATION_BUDGET = 2000;
+	unsigned long long MAX_EVALUATION_BUDGET = 1000000;
+	unsigned ELIMINATION_RATE = 2;
+
+	vector<ga_parameters> candidates;
+	vector<tuning_result> results;
+	size_t best_candidate = 0;
+	bool is_tuned = false;
+
+	double getRunCost(const batch_run_result & result);
+	static bool isBetter(const tuning_result & result1, const tuning_result & result2);
+};
+
+/**
+ * IMPLEMENTATION OF METHODS OF CLASS "parameter_tuner"
+ * ====================================================
+ */
+
+inline void parameter_tuner::setSeeds(size_t num_of_seeds, uint64_t first_seed)
+{
+	if(num_of_seeds < 1)
+	{
+		cerr<<"error number of seeds : "<<num_of_seeds<<" (less than 1 is not allowed)."
+				<<" keeping "<<NUM_OF_SEEDS<<endl;
+		return;
+	}
+	NUM_OF_SEEDS = num_of_seeds;
+	FIRST_SEED = first_seed;
+}
+
+inline void parameter_tuner::setRace(unsigned long long min_evaluation_budget,
+		unsigned long long max_evaluation_budget, unsigned elimination_rate)
+{
+	if(min_evaluation_budget < 1 || max_evaluation_budget < min_evaluation_budget
+			|| elimination_rate < 2)
+	{
+		cerr<<"error race settings : budgets "<<min_evaluation_budget<<" to "
+				<<max_evaluation_budget<<", elimination rate "<<elimination_rate
+				<<" (budgets must be at least 1 and increasing, rate at least 2)."
+				<<" keeping previous settings"<<endl;
+		return;
+	}
+	MIN_EVALUATION_BUDGET = min_evaluation_budget;
+	MAX_EVALUATION_BUDGET = max_evaluation_budget;
+	ELIMINATION_RATE = elimination_rate;
+}
+
+inline void parameter_tuner::addRandomCandidates(const ga_parameter_space & space,
+		size_t num_of_candidates, uint64_t seed)
+{
+	xoshiro256ss random_engine(seed);
+	uniform_real_distribution<double> uniform_distribution(0, 1);
+	auto uniform = [&](double min_value, double max_value)
+	{
+		return min_value + uniform_distribution(random_engine)*(max_value - min_value);
+	};
+
+	const double log_min_population = log((double) max(2LL, space.min_population_size));
+	const double log_max_population = log((double) max(2LL, space.max_population_size));
+	for(size_t c = 0; c < num_of_candidates; c++)
+	{
+		ga_parameters parameters;
+		parameters.population_size = llround(exp(uniform(log_min_population, log_max_population)));
+		parameters.crossover_prob = uniform(space.min_crossover_prob, space.max_crossover_prob);
+		parameters.mutation_prob = uniform(space.min_mutation_prob, space.max_mutation_prob);
+		parameters.allele_mutation_prob =
+			uniform(space.min_allele_mutation_prob, space.max_allele_mutation_prob);
+		candidates.push_back(parameters);
+	}
+}
+
+template<typename Factory>
+ga_parameters parameter_tuner::tune(Factory factory)
+{
+	results.clear();
+	is_tuned = false;
+	if(candidates.empty())
+	{
+		cerr<<"error no candidates to tune, returning default parameters"<<endl;
+		return ga_parameters();
+	}
+
+	vector<size_t> survivors(candidates.size());
+	for(size_t c = 0; c < candidates.size(); c++)
+	{
+		survivors[c] = c;
+	}
+
+	unsigned long long budget = MIN_EVALUATION_BUDGET;
+	const double target_fitness = TARGET_FITNESS;
+	for(size_t round = 0; ; round++)
+	{
+		// every survivor is run with same seeds, from scratch with the budget of this round
+		batch_runner runner(NUM_OF_THREADS);
+		for(size_t c : survivors)
+		{
+			const ga_parameters parameters = candidates[c];
+			runner.addRuns(to_string(c), NUM_OF_SEEDS, FIRST_SEED, target_fitness,
+					[factory, parameters, budget, target_fitness]()
+			{
+				auto gaP = factory();
+				gaP->setParameters(parameters.population_size, -1, parameters.crossover_prob,
+						parameters.mutation_prob, parameters.allele_mutation_prob, true);
+				gaP->setStoppingCriterion(orCriteria(stopOnTarget(target_fitness),
+						stopAfterEvaluations(budget)));
+				return gaP;
+			});
+		}
+		runner.run();
+
+		// summaries are in the order configurations were added (order of survivors)
+		vector<tuning_result> round_results(survivors.size());
+		for(size_t s = 0; s < survivors.size(); s++)
+		{
+			const string configuration = to_string(survivors[s]);
+			tuning_result & round_result = round_results[s];
+			round_result.candidate = survivors[s];
+			round_result.round = round;
+			round_result.evaluation_budget = budget;
+			round_result.median_fitness = runner.getSummaries()[s].median_fitness;
+
+			double cost_sum = 0;
+			for(const batch_run_result & result : runner.getResults())
+			{
+				if(result.configuration == configuration)
+				{
+					cost_sum += getRunCost(result);
+					round_result.num_of_runs++;
+					round_result.num_of_runs_reached += result.target_reached;
+				}
+			}
+			round_result.score = cost_sum/max((size_t) 1, round_result.num_of_runs);
+		}
+
+		stable_sort(round_results.begin(), round_results.end(), isBetter);
+		const bool is_last_round = survivors.size() == 1
+				|| budget > MAX_EVALUATION_BUDGET/ELIMINATION_RATE;
+		const size_t num_of_survivors = is_last_round ?
+				1 : (survivors.size() + ELIMINATION_RATE - 1)/ELIMINATION_RATE;
+		survivors.clear();
+		for(size_t s = 0; s < round_results.size(); s++)
+		{
+			round_results[s].is_eliminated = s >= num_of_survivors;
+			if(s < num_of_survivors)
+			{
+				survivors.push_back(round_results[s].candidate);
+			}
+			results.push_back(round_results[s]);
+		}
+
+		// a single survivor is not raced again
+		if(is_last_round || num_of_survivors == 1)
+		{
+			break;
+		}
+		budget *= ELIMINATION_RATE;
+	}
+
+	best_candidate = survivors.front();
+	is_tuned = true;
+	return candidates[best_candidate];
+}
+
+/**
+ * cost of a run for the objective (PAR2 : twice the used cost if target was not reached)
+ */
+inline double parameter_tuner::getRunCost(const batch_run_result & result)
+{
+	if(OBJECTIVE == TUNE_TIME_TO_TARGET)
+	{
+		return result.target_reached ? result.time_to_target_seconds : 2*result.elapsed_seconds;
+	}
+	return result.target_reached ?
+			result.evaluations_to_target : 2.0*result.num_of_evaluations;
+}
+
+/**
+ * lower score first, equal scores by higher median fitness
+ */
+inline bool parameter_tuner::isBetter(const tuning_result & result1,
+		const tuning_result & result2)
+{
+	if(result1.score != result2.score)
+	{
+		return result1.score < result2.score;
+	}
+	return result1.median_fitness > result2.median_fitness;
+}
+
+inline void parameter_tuner::writeBestParameters(ostream & out)
+{
+	if(!is_tuned)
+	{
+		cerr<<"error parameters are not tuned yet (call tune first)"<<endl;
+		return;
+	}
+
+	// score of best candidate in last round
+	const ga_parameters & best = candidates[best_candidate];
+	double score = NAN;
+	for(const tuning_result & result : results)
+	{
+		if(result.candidate == best_candidate)
+		{
+			score = result.score;
+		}
+	}
+
+	out<<"{\"population_size\": "<<best.population_size
+			<<", \"crossover_prob\": "<<best.crossover_prob
+			<<", \"mutation_prob\": "<<best.mutation_prob
+			<<", \"allele_mutation_prob\": "<<best.allele_mutation_prob
+			<<", \"objective\": \""<<(OBJECTIVE == TUNE_TIME_TO_TARGET ?
+					"seconds_to_target" : "evaluations_to_target")<<"\""
+			<<", \"score\": "<<score<<"}"<<endl;
+}
+
+inline void parameter_tuner::writeCsv(ostream & out)
+{
+	out<<"round,candidate,population_size,crossover_prob,mutation_prob,allele_mutation_prob,"
+			<<"evaluation_budget,runs,runs_reached_target,score,median_fitness,eliminated"<<endl;
+	for(const tuning_result & result : results)
+	{
+		const ga_parameters & parameters = candidates[result.candidate];
+		out<<result.round<<","<<result.candidate<<","<<parameters.population_size
+				<<","<<parameters.crossover_prob<<","<<parameters.mutation_prob
+				<<","<<parameters.allele_mutation_prob<<","<<result.evaluation_budget
+				<<","<<result.num_of_runs<<","<<result.num_of_runs_reached
+				<<","<<result.score<<","<<result.median_fitness
+				<<","<<result.is_eliminated<<endl;
+	}
+}
+}
+
+#endif /* PARAMETER_TUNER_H_ */
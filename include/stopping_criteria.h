@@ -0,0 +1,301 @@
+/*
+ * stopping_criteria.h
+ * Stopping criteria that can be combined and set on simple_ga
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef STOPPING_CRITERIA_H_
+#define STOPPING_CRITERIA_H_
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <initializer_list>
+#include "ga_statistics.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * STOPPING CRITERION (stopping_criterion)
+ * =======================================
+ * shouldStop() is checked once after each generation with current statistics.
+ * reset() is called at start of each GA run (for criteria that keep their own state).
+ *
+ */
+class stopping_criterion
+{
+public :
+	virtual bool shouldStop(const ga_statistics & statistics) = 0;
+	virtual void reset() { }
+	virtual ~stopping_criterion() { }
+};
+
+typedef shared_ptr<stopping_criterion> stopping_criterionP;
+
+
+/**
+ * STAGNATION - stop when best fitness has not improved for given number of generations.
+ * Best fitness is improved only when it increases by more than
+ * relative_epsilon * |previous best fitness| (0 means any increase).
+ */
+class stagnation_criterion : public stopping_criterion
+{
+public :
+	stagnation_criterion(long long max_generations_without_improvement,
+			double relative_epsilon = 0) :
+		MAX_GENERATIONS_WITHOUT_IMPROVEMENT(max_generations_without_improvement),
+		RELATIVE_EPSILON(relative_epsilon)
+	{
+	}
+
+	bool shouldStop(const ga_statistics & statistics) override
+	{
+		if(!has_reference || statistics.best_fitness > reference_fitness
+				+ RELATIVE_EPSILON*abs(reference_fitness))
+		{
+			has_reference = true;
+			reference_fitness = statistics.best_fitness;
+			reference_generation = statistics.num_of_generations;
+		}
+		return statistics.num_of_generations - reference_generation
+			>= MAX_GENERATIONS_WITHOUT_IMPROVEMENT;
+	}
+
+	void reset() override
+	{
+		has_reference = false;
+	}
+
+private:
+	const long long MAX_GENERATIONS_WITHOUT_IMPROVEMENT;
+	const double RELATIVE_EPSILON;
+
+	bool has_reference = false;
+	double reference_fitness = 0;
+	long long reference_generation = 0;
+};
+
+/**
+ * WALL-CLOCK BUDGET - stop when GA has run for given number of seconds
+ */
+class time_budget_criterion : public stopping_criterion
+{
+public :
+	explicit time_budget_criterion(double max_seconds) : MAX_SECONDS(max_seconds) { }
+
+	bool shouldStop(const ga_statistics & statistics) override
+	{
+		return statistics.elapsed_seconds >= MAX_SECONDS;
+	}
+
+private:
+	const double MAX_SECONDS;
+};
+
+/**
+ * EVALUATION BUDGET - stop when fitness has been calculated given number of times
+ */
+class evaluation_budget_criterion : public stopping_criterion
+{
+public :
+	explicit evaluation_budget_criterion(unsigned long long max_evaluations) :
+		MAX_EVALUATIONS(max_evaluations)
+	{
+	}
+
+	bool shouldStop(const ga_statistics & statistics) override
+	{
+		return statistics.num_of_evaluations >= MAX_EVALUATIONS;
+	}
+
+private:
+	const unsigned long long MAX_EVALUATIONS;
+};
+
+/**
+ * TARGET FITNESS - stop when best fitness reaches given fitness
+ */
+class target_fitness_criterion : public stopping_criterion
+{
+public :
+	explicit target_fitness_criterion(double target_fitness) :
+		TARGET_FITNESS(target_fitness)
+	{
+	}
+
+	bool shouldStop(const ga_statistics & statistics) override
+	{
+		return statistics.best_fitness >= TARGET_FITNESS;
+	}
+
+private:
+	const double TARGET_FITNESS;
+};
+
+/**
+ * CONVERGENCE - stop when average fitness of current generation is within
+ * given percentage of its best fitness
+ */
+class convergence_criterion : public stopping_criterion
+{
+public :
+	explicit convergence_criterion(double max_percent_difference) :
+		MAX_PERCENT_DIFFERENCE(max_percent_difference)
+	{
+	}
+
+	bool shouldStop(const ga_statistics & statistics) override
+	{
+		return abs(statistics.gen_best_fitness - statistics.avg_fitness)
+			<= MAX_PERCENT_DIFFERENCE/100*abs(statistics.gen_best_fitness);
+	}
+
+private:
+	const double MAX_PERCENT_DIFFERENCE;
+};
+
+/**
+ * LOW DIVERSITY - stop when estimated mean distance between individuals falls
+ * below given distance (needs diversity tracking of GA, see setDiversityTracking)
+ */
+class diversity_criterion : public stopping_criterion
+{
+public :
+	explicit diversity_criterion(double min_mean_distance) :
+		MIN_MEAN_DISTANCE(min_mean_distance)
+	{
+	}
+
+	bool shouldStop(const ga_statistics & statistics) override
+	{
+		return statistics.diversity.is_tracked
+			&& statistics.diversity.mean_distance < MIN_MEAN_DISTANCE;
+	}
+
+private:
+	const double MIN_MEAN_DISTANCE;
+};
+
+
+/**
+ * OR - stop when any of the criteria says stop
+ * AND - stop when all of the criteria say stop
+ * (each criterion is checked every time, so that criteria with state stay updated)
+ */
+class any_criterion : public stopping_criterion
+{
+public :
+	explicit any_criterion(initializer_list<stopping_criterionP> all_criteria) :
+		criteria(all_criteria)
+	{
+	}
+
+	bool shouldStop(const ga_statistics & statistics) override
+	{
+		bool should_stop = false;
+		for(const stopping_criterionP & criterion : criteria)
+		{
+			should_stop = criterion->shouldStop(statistics) || should_stop;
+		}
+		return should_stop;
+	}
+
+	void reset() override
+	{
+		for(const stopping_criterionP & criterion : criteria)
+		{
+			criterion->reset();
+		}
+	}
+
+private:
+	vector<stopping_criterionP> criteria;
+};
+
+class all_criterion : public stopping_criterion
+{
+public :
+	explicit all_criterion(initializer_list<stopping_criterionP> all_criteria) :
+		criteria(all_criteria)
+	{
+	}
+
+	bool shouldStop(const ga_statistics & statistics) override
+	{
+		bool should_stop = true;
+		for(const stopping_criterionP & criterion : criteria)
+		{
+			should_stop = criterion->shouldStop(statistics) && should_stop;
+		}
+		return should_stop;
+	}
+
+	void reset() override
+	{
+		for(const stopping_criterionP & criterion : criteria)
+		{
+			criterion->reset();
+		}
+	}
+
+private:
+	vector<stopping_criterionP> criteria;
+};
+
+
+/**
+ * helper functions to create and combine criteria, for example :
+ * orCriteria(stopOnTarget(0), andCriteria(stopOnStagnation(100), stopAfterSeconds(60)))
+ */
+inline stopping_criterionP stopOnStagnation(long long max_generations_without_improvement,
+		double relative_epsilon = 0)
+{
+	return make_shared<stagnation_criterion>(max_generations_without_improvement,
+			relative_epsilon);
+}
+
+inline stopping_criterionP stopAfterSeconds(double max_seconds)
+{
+	return make_shared<time_budget_criterion>(max_seconds);
+}
+
+inline stopping_criterionP stopAfterEvaluations(unsigned long long max_evaluations)
+{
+	return make_shared<evaluation_budget_criterion>(max_evaluations);
+}
+
+inline stopping_criterionP stopOnTarget(double target_fitness)
+{
+	return make_shared<target_fitness_criterion>(target_fitness);
+}
+
+inline stopping_criterionP stopOnConvergence(double max_percent_difference)
+{
+	return make_shared<convergence_criterion>(max_percent_difference);
+}
+
+inline stopping_criterionP stopOnLowDiversity(double min_mean_distance)
+{
+	return make_shared<diversity_criterion>(min_mean_distance);
+}
+
+inline stopping_criterionP orCriteria(const stopping_criterionP & criterion1,
+		const stopping_criterionP & criterion2)
+{
+	return make_shared<any_criterion>(initializer_list<stopping_criterionP>
+		{criterion1, criterion2});
+}
+
+inline stopping_criterionP andCriteria(const stopping_criterionP & criterion1,
+		const stopping_criterionP & criterion2)
+{
+	return make_shared<all_criterion>(initializer_list<stopping_criterionP>
+		{criterion1, criterion2});
+}
+}
+
+#endif /* STOPPING_CRITERIA_H_ */
@@ -0,0 +1,425 @@
+/*
+ * surrogate.h
+ * Surrogate models that predict fitness from individuals evaluated so far
+ * (k nearest neighbors and radial basis functions)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef SURROGATE_H_
+#define SURROGATE_H_
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include "util/genome_traits.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * SURROGATE MODEL
+ * ===============
+ * A cheap model of fitness, used by simple_ga to screen offspring before they are
+ * evaluated (see setSurrogate of simple_ga).
+ *
+ * update(indiv, fitness) - add an evaluated individual to archive of model
+ *                          (model is updated incrementally)
+ * predict(indiv, fitness, is_archived) - predicted fitness of an individual, returns
+ *                           false if model can not predict yet (e.g. too few individuals).
+ *                           is_archived is set if individual is in archive, fitness is
+ *                           then its evaluated fitness.
+ *
+ */
+template<typename T>
+class surrogate_model
+{
+public :
+	virtual void update(const T & indiv, double fitness) = 0;
+	virtual bool predict(const T & indiv, double & fitness, bool & is_archived) = 0;
+
+	virtual ~surrogate_model() { }
+};
+
+
+/**
+ * K NEAREST NEIGHBORS SURROGATE (knn_surrogate)
+ * =============================================
+ * Predicted fitness is mean fitness of the k nearest archived individuals, weighted
+ * by inverse of their distance (an archived individual equal to the given one gives
+ * its own fitness). Archive keeps last archive_capacity individuals (oldest is replaced),
+ * and it predicts once it has min_archive_size individuals.
+ *
+ * Distance is distance of genome_traits (see "util/genome_traits.h"), e.g. Hamming
+ * distance for permutations. Each prediction is O(archive size).
+ *
+ */
+template<typename T>
+class knn_surrogate : public surrogate_model<T>
+{
+	static_assert(genome_traits<T>::is_supported,
+			"k-NN surrogate needs genome_traits (distance) of individual");
+
+public :
+	explicit knn_surrogate(size_t num_of_neighbors = 5, size_t archive_capacity = 1000,
+			size_t min_archive_size = 20) :
+		NUM_OF_NEIGHBORS(max((size_t) 1, num_of_neighbors)),
+		ARCHIVE_CAPACITY(max((size_t) 1, archive_capacity)),
+		MIN_ARCHIVE_SIZE(max((size_t) 1, min_archive_size)) { }
+
+	void update(const T & indiv, double fitness) override
+	{
+		if(std::isnan(fitness))
+		{
+			return;
+		}
+
+		if(archive.size() < ARCHIVE_CAPACITY)
+		{
+			archive.push_back(indiv);
+			archive_fitness.push_back(fitness);
+			return;
+		}
+		archive[oldest_index] = indiv;
+		archive_fitness[oldest_index] = fitness;
+		oldest_index = (oldest_index + 1) % ARCHIVE_CAPACITY;
+	}
+
+	bool predict(const T & indiv, double & fitness, bool & is_archived) override;
+
+	size_t getArchiveSize()
+	{
+		return archive.size();
+	}
+
+private:
+	const size_t NUM_OF_NEIGHBORS;
+	const size_t ARCHIVE_CAPACITY;
+	const size_t MIN_ARCHIVE_SIZE;
+
+	vector<T> archive;
+	vector<double> archive_fitness;
+	size_t oldest_index = 0;
+
+	// nearest neighbors found so far (distance, fitness), sorted by distance
+	vector<pair<double, double>> neighbors;
+};
+
+
+/**
+ * RADIAL BASIS FUNCTION SURROGATE (rbf_surrogate)
+ * ===============================================
+ * Predicted fitness is an interpolation of archived individuals x_i with Gaussian
+ * radial basis functions :
+ *      s(x) = mean fitness + sum of w_i*exp(-(d(x, x_i)/width)^2)
+ * where weights w solve (K + regularization*I) w = fitness - mean fitness,
+ * K(i, j) = exp(-(d(x_i, x_j)/width)^2).
+ *
+ * INCREMENTAL UPDATE - Cholesky factor of K is extended by a row for each new individual
+ * (O(n^2)), and weights are solved again (O(n^2)) only before next prediction.
+ * An individual (almost) equal to an archived one is not added.
+ *
+ * WIDTH - twice the mean distance of archived individuals to their nearest neighbor.
+ * It is estimated again (and factor is rebuilt, O(n^3)) when archive has doubled
+ * since last estimate. When archive is full, older half of it is dropped.
+ *
+ * It suits smooth fitness of continuous variables (e.g. function_minimizer_ga, with
+ * Euclidean distance of genome_traits). It predicts once it has min_archive_size
+ * individuals.
+ *
+ */
+template<typename T>
+class rbf_surrogate : public surrogate_model<T>
+{
+	static_assert(genome_traits<T>::is_supported,
+			"RBF surrogate needs genome_traits (distance) of individual");
+
+public :
+	explicit rbf_surrogate(size_t archive_capacity = 256, size_t min_archive_size = 10,
+			double regularization = 1e-8) :
+		ARCHIVE_CAPACITY(max((size_t) 2, archive_capacity)),
+		MIN_ARCHIVE_SIZE(min(max((size_t) 1, min_archive_size), ARCHIVE_CAPACITY)),
+		REGULARIZATION(regularization) { }
+
+	void update(const T & indiv, double fitness) override;
+	bool predict(const T & indiv, double & fitness, bool & is_archived) override;
+
+	size_t getArchiveSize()
+	{
+		return archive.size();
+	}
+
+private:
+	const size_t ARCHIVE_CAPACITY;
+	const size_t MIN_ARCHIVE_SIZE;
+	const double REGULARIZATION;
+
+	vector<T> archive;
+	vector<double> archive_fitness;
+
+	// lower triangular Cholesky factor of kernel matrix (rows of ARCHIVE_CAPACITY values),
+	// it covers whole archive once archive has MIN_ARCHIVE_SIZE individuals
+	vector<double> factor;
+	bool is_factored = false;
+	size_t factored_size = 0;
+	double width = 1;
+
+	// weights of basis functions (solved before prediction if not valid)
+	vector<double> weights;
+	vector<double> solve_buffer;
+	double mean_fitness = 0;
+	bool is_weights_valid = false;
+
+	double kernel(double distance)
+	{
+		const double scaled_distance = distance/width;
+		return exp(-scaled_distance*scaled_distance);
+	}
+
+	void refactor();
+	bool appendToFactor(size_t index);
+	void solveWeights();
+};
+
+
+/**
+ * IMPLEMENTATION OF SURROGATE MODELS
+ * ==================================
+ */
+
+template<typename T>
+bool knn_surrogate<T>::predict(const T & indiv, double & fitness, bool & is_archived)
+{
+	is_archived = false;
+	if(archive.size() < MIN_ARCHIVE_SIZE)
+	{
+		return false;
+	}
+
+	neighbors.clear();
+	for(size_t a = 0; a < archive.size(); a++)
+	{
+		const double distance = genome_traits<T>::distance(indiv, archive[a]);
+		if(distance == 0)
+		{
+			fitness = archive_fitness[a];
+			is_archived = true;
+			return true;
+		}
+		if(neighbors.size() == NUM_OF_NEIGHBORS && distance >= neighbors.back().first)
+		{
+			continue;
+		}
+
+		// insert in order of distance (k is small)
+		if(neighbors.size() == NUM_OF_NEIGHBORS)
+		{
+			neighbors.pop_back();
+		}
+		neighbors.push_back(make_pair(distance, archive_fitness[a]));
+		for(size_t n = neighbors.size() - 1; n > 0 && neighbors[n].first < neighbors[n - 1].first; n--)
+		{
+			swap(neighbors[n], neighbors[n - 1]);
+		}
+	}
+
+	double weight_sum = 0;
+	double weighted_fitness_sum = 0;
+	for(const pair<double, double> & neighbor : neighbors)
+	{
+		const double weight = 1/neighbor.first;
+		weight_sum += weight;
+		weighted_fitness_sum += weight*neighbor.second;
+	}
+	fitness = weighted_fitness_sum/weight_sum;
+	return true;
+}
+
+template<typename T>
+void rbf_surrogate<T>::update(const T & indiv, double fitness)
+{
+	if(std::isnan(fitness))
+	{
+		return;
+	}
+
+	// drop older half of a full archive
+	if(archive.size() == ARCHIVE_CAPACITY)
+	{
+		const size_t num_of_dropped = ARCHIVE_CAPACITY/2;
+		archive.erase(archive.begin(), archive.begin() + num_of_dropped);
+		archive_fitness.erase(archive_fitness.begin(), archive_fitness.begin() + num_of_dropped);
+		is_factored = false;
+		if(archive.size() >= MIN_ARCHIVE_SIZE)
+		{
+			refactor();
+		}
+	}
+
+	archive.push_back(indiv);
+	archive_fitness.push_back(fitness);
+	is_weights_valid = false;
+
+	if(archive.size() < MIN_ARCHIVE_SIZE)
+	{
+		return;
+	}
+	if(!is_factored || archive.size() >= 2*factored_size)
+	{
+		refactor();
+	}
+	else if(!appendToFactor(archive.size() - 1))
+	{
+		archive.pop_back();
+		archive_fitness.pop_back();
+	}
+}
+
+/**
+ * estimate width of basis functions and factor kernel matrix of whole archive
+ * (individuals that can not be added to factor are removed from archive)
+ */
+template<typename T>
+void rbf_surrogate<T>::refactor()
+{
+	double nearest_distance_sum = 0;
+	size_t num_of_distances = 0;
+	for(size_t i = 0; i < archive.size(); i++)
+	{
+		double nearest_distance = HUGE_VAL;
+		for(size_t j = 0; j < archive.size(); j++)
+		{
+			const double distance = genome_traits<T>::distance(archive[i], archive[j]);
+			if(j != i && distance > 0)
+			{
+				nearest_distance = min(nearest_distance, distance);
+			}
+		}
+		if(nearest_distance < HUGE_VAL)
+		{
+			nearest_distance_sum += nearest_distance;
+			num_of_distances++;
+		}
+	}
+	width = num_of_distances > 0 ? 2*nearest_distance_sum/num_of_distances : 1;
+
+	factor.assign(ARCHIVE_CAPACITY*ARCHIVE_CAPACITY, 0);
+	factored_size = 0;
+	for(size_t i = 0; i < archive.size();)
+	{
+		if(appendToFactor(i))
+		{
+			i++;
+		}
+		else
+		{
+			archive.erase(archive.begin() + i);
+			archive_fitness.erase(archive_fitness.begin() + i);
+		}
+	}
+	is_factored = true;
+	is_weights_valid = false;
+}
+
+/**
+ * add row of individual at index (== factored_size) to Cholesky factor,
+ * returns false if it is (numerically) a combination of archived individuals
+ */
+template<typename T>
+bool rbf_surrogate<T>::appendToFactor(size_t index)
+{
+	const double MIN_PIVOT = 1e-12;
+	double * row = factor.data() + factored_size*ARCHIVE_CAPACITY;
+	double pivot = 1 + REGULARIZATION;
+	for(size_t j = 0; j < factored_size; j++)
+	{
+		const double * row_j = factor.data() + j*ARCHIVE_CAPACITY;
+		double value = kernel(genome_traits<T>::distance(archive[index], archive[j]));
+		for(size_t m = 0; m < j; m++)
+		{
+			value -= row[m]*row_j[m];
+		}
+		row[j] = value/row_j[j];
+		pivot -= row[j]*row[j];
+	}
+	if(pivot <= MIN_PIVOT)
+	{
+		return false;
+	}
+	row[factored_size] = sqrt(pivot);
+	factored_size++;
+	return true;
+}
+
+/**
+ * weights from Cholesky factor (forward and back substitution)
+ */
+template<typename T>
+void rbf_surrogate<T>::solveWeights()
+{
+	const size_t n = factored_size;
+	mean_fitness = 0;
+	for(size_t i = 0; i < n; i++)
+	{
+		mean_fitness += archive_fitness[i];
+	}
+	mean_fitness /= n;
+
+	solve_buffer.resize(n);
+	for(size_t i = 0; i < n; i++)
+	{
+		const double * row_i = factor.data() + i*ARCHIVE_CAPACITY;
+		double value = archive_fitness[i] - mean_fitness;
+		for(size_t m = 0; m < i; m++)
+		{
+			value -= row_i[m]*solve_buffer[m];
+		}
+		solve_buffer[i] = value/row_i[i];
+	}
+
+	weights.resize(n);
+	for(size_t i = n; i-- > 0;)
+	{
+		double value = solve_buffer[i];
+		for(size_t m = i + 1; m < n; m++)
+		{
+			value -= factor[m*ARCHIVE_CAPACITY + i]*weights[m];
+		}
+		weights[i] = value/factor[i*ARCHIVE_CAPACITY + i];
+	}
+	is_weights_valid = true;
+}
+
+template<typename T>
+bool rbf_surrogate<T>::predict(const T & indiv, double & fitness, bool & is_archived)
+{
+	is_archived = false;
+	if(!is_factored || factored_size < MIN_ARCHIVE_SIZE)
+	{
+		return false;
+	}
+	if(!is_weights_valid)
+	{
+		solveWeights();
+	}
+
+	double predicted_fitness = mean_fitness;
+	for(size_t i = 0; i < factored_size; i++)
+	{
+		const double distance = genome_traits<T>::distance(indiv, archive[i]);
+		if(distance == 0)
+		{
+			fitness = archive_fitness[i];
+			is_archived = true;
+			return true;
+		}
+		predicted_fitness += weights[i]*kernel(distance);
+	}
+	fitness = predicted_fitness;
+	return true;
+}
+}
+
+#endif /* SURROGATE_H_ */
@@ -0,0 +1,156 @@
+/*
+ * arena.h
+ * Arena (bump) allocator for temporary memory of a generation
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef ARENA_H_
+#define ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * GENERATION ARENA (generation_arena)
+ * ===================================
+ * Memory is taken from large blocks by moving an offset, and is never freed one by one.
+ * reset() makes all memory available again in O(1) (blocks are kept for reuse),
+ * so after the first few generations no memory is allocated from the heap.
+ *
+ * Memory from the arena must not be used after reset(). Not thread safe.
+ *
+ */
+class generation_arena
+{
+public :
+	explicit generation_arena(size_t block_size = 64*1024) :
+		BLOCK_SIZE(block_size)
+	{
+	}
+
+	void * allocate(size_t size, size_t alignment)
+	{
+		while(true)
+		{
+			if(current_block < blocks.size())
+			{
+				const uintptr_t block_start = (uintptr_t) blocks[current_block].get();
+				const uintptr_t aligned = (block_start + offset + alignment - 1)
+					& ~((uintptr_t) alignment - 1);
+				const size_t new_offset = aligned - block_start + size;
+				if(new_offset <= block_sizes[current_block])
+				{
+					offset = new_offset;
+					return (void *) aligned;
+				}
+				// try next block (if there is one) from its start
+				if(current_block + 1 < blocks.size()
+						&& size + alignment <= block_sizes[current_block + 1])
+				{
+					current_block++;
+					offset = 0;
+					continue;
+				}
+			}
+
+			// add a new block after current block
+			const size_t new_block_size = max(BLOCK_SIZE, size + alignment);
+			const size_t new_block = blocks.empty() ? 0 : current_block + 1;
+			blocks.insert(blocks.begin() + new_block,
+					unique_ptr<char[]>(new char[new_block_size]));
+			block_sizes.insert(block_sizes.begin() + new_block, new_block_size);
+			current_block = new_block;
+			offset = 0;
+		}
+	}
+
+	/**
+	 * make all memory of arena available again
+	 */
+	void reset()
+	{
+		current_block = 0;
+		offset = 0;
+	}
+
+	size_t getNumOfBlocks()
+	{
+		return blocks.size();
+	}
+
+private:
+	const size_t BLOCK_SIZE;
+
+	vector<unique_ptr<char[]>> blocks;
+	vector<size_t> block_sizes;
+	size_t current_block = 0;
+	size_t offset = 0;
+
+	// non-copyable since memory given out points into its blocks
+	generation_arena(const generation_arena & _generation_arena);
+	generation_arena & operator=(const generation_arena & _generation_arena);
+};
+
+/**
+ * ARENA ALLOCATOR (arena_allocator)
+ * =================================
+ * Standard allocator that takes memory from a generation_arena, for temporary
+ * containers of a generation, e.g. vector<int, arena_allocator<int>>.
+ * deallocate() does nothing, memory is available again after reset() of arena.
+ *
+ */
+template<typename U>
+class arena_allocator
+{
+public :
+	typedef U value_type;
+
+	explicit arena_allocator(generation_arena & arena) : arenaP(&arena) { }
+
+	template<typename V>
+	arena_allocator(const arena_allocator<V> & other) : arenaP(other.arenaP) { }
+
+	U * allocate(size_t n)
+	{
+		return static_cast<U *>(arenaP->allocate(n*sizeof(U), alignof(U)));
+	}
+
+	void deallocate(U * p, size_t n)
+	{
+	}
+
+	template<typename V>
+	bool operator==(const arena_allocator<V> & other) const
+	{
+		return arenaP == other.arenaP;
+	}
+
+	template<typename V>
+	bool operator!=(const arena_allocator<V> & other) const
+	{
+		return arenaP != other.arenaP;
+	}
+
+private:
+	template<typename V> friend class arena_allocator;
+
+	generation_arena * arenaP;
+};
+
+/**
+ * vector for temporary values of a generation
+ */
+template<typename U>
+using arena_vector = vector<U, arena_allocator<U>>;
+}
+
+#endif /* ARENA_H_ */
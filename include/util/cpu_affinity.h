@@ -0,0 +1,72 @@
+/*
+ * cpu_affinity.h
+ * Pinning threads to CPUs (so that memory they first touch stays on their NUMA node)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef CPU_AFFINITY_H_
+#define CPU_AFFINITY_H_
+
+#include <vector>
+#include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * CPUs this process is allowed to run on (e.g. restricted by taskset or cgroups),
+ * in increasing order. If it is not known, all hardware threads are returned.
+ */
+inline vector<unsigned> getAllowedCpus()
+{
+	vector<unsigned> cpus;
+#ifdef __linux__
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	if(sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0)
+	{
+		for(unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++)
+		{
+			if(CPU_ISSET(cpu, &cpu_set))
+			{
+				cpus.push_back(cpu);
+			}
+		}
+	}
+#endif
+	if(cpus.empty())
+	{
+		for(unsigned cpu = 0; cpu < max(1u, thread::hardware_concurrency()); cpu++)
+		{
+			cpus.push_back(cpu);
+		}
+	}
+	return cpus;
+}
+
+/**
+ * run a thread only on given CPU, returns false if it is not supported or failed.
+ * With first touch policy of the OS, memory first written by a pinned thread
+ * is placed on NUMA node of its CPU.
+ */
+inline bool pinThread(thread & a_thread, unsigned cpu)
+{
+#ifdef __linux__
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	CPU_SET(cpu, &cpu_set);
+	return pthread_setaffinity_np(a_thread.native_handle(), sizeof(cpu_set), &cpu_set) == 0;
+#else
+	return false;
+#endif
+}
+}
+
+#endif /* CPU_AFFINITY_H_ */
@@ -9,6 +9,7 @@
 #ifndef CROSSOVERS_H_
 #define CROSSOVERS_H_
 
+#include <array>
 #include <vector>
 #include "ga.h"
 
@@ -41,6 +42,23 @@ template<typename T>
 vector<T> twoPointCrossover(const vector<T> & parent1, const vector<T> & parent2);
 
 
+/**
+ * CROSSOVERS OF FIXED LENGTH GENOMES
+ * ==================================
+ * 1-point and 2-point crossover of std::array individuals (N alleles, known at compile time).
+ * Crossover points are drawn from the given random engine, and offspring is returned
+ * by value (no heap allocation).
+ *
+ */
+template<typename T, size_t N, typename RandomEngine>
+array<T, N> onePointCrossover(const array<T, N> & parent1, const array<T, N> & parent2,
+		RandomEngine & random_engine);
+
+template<typename T, size_t N, typename RandomEngine>
+array<T, N> twoPointCrossover(const array<T, N> & parent1, const array<T, N> & parent2,
+		RandomEngine & random_engine);
+
+
 /**
  * IMPLEMENTATION OF CROSSOVERS
  * ============================
@@ -56,29 +74,25 @@ vector<T> onePointCrossover(const vector<T> & parent1, const vector<T> & parent2
 		// shuffle between first and second parent
 		// to remove any bias (specially for individuals with large number of allele)
 		static mt19937 random_engine_shuffle;
-		static uniform_real_distribution<float> distrib_shuffle(0.0, 1.0);
-		vector<int> temp_parent;
-		if(distrib_shuffle(random_engine_shuffle) < 0.5f)
-		{
-			temp_parent = parent1;
-			parent1 = parent2;
-			parent2 = temp_parent;
-		}
+		uniform_real_distribution<float> distrib_shuffle(0.0, 1.0);
+		const bool is_swapped = distrib_shuffle(random_engine_shuffle) < 0.5f;
+		const vector<T> & first_parent = is_swapped ? parent2 : parent1;
+		const vector<T> & second_parent = is_swapped ? parent1 : parent2;
 
 		// crossover point 1 engine generator
 		static mt19937 random_engine_point1(1);
-		static uniform_int_distribution<int> distrib1(1, TOTAL_LENGTH - 1);
+		uniform_int_distribution<int> distrib1(1, TOTAL_LENGTH - 1);
 		int crossover_point1 = distrib1(random_engine_point1);
 
 		vector<T> indiv(TOTAL_LENGTH);
 		for(int i = 0; i < crossover_point1; i++)
 		{
-			indiv[i] = parent1[i];
+			indiv[i] = first_parent[i];
 		}
 
 		for(int i = crossover_point1; i < TOTAL_LENGTH; i++)
 		{
-			indiv[i] = parent2[i];
+			indiv[i] = second_parent[i];
 		}
 
 		return indiv;
@@ -101,23 +115,19 @@ vector<T> twoPointCrossover(const vector<T> & parent1, const vector<T> & parent2
 		// shuffle between first and second parent
 		// to remove any bias for individuals specially with large number of allele
 		static mt19937 random_engine_shuffle;
-		static uniform_real_distribution<float> distrib_shuffle(0.0, 1.0);
-		vector<int> temp_parent;
-		if(distrib_shuffle(random_engine_shuffle) < 0.5f)
-		{
-			temp_parent = parent1;
-			parent1 = parent2;
-			parent2 = temp_parent;
-		}
+		uniform_real_distribution<float> distrib_shuffle(0.0, 1.0);
+		const bool is_swapped = distrib_shuffle(random_engine_shuffle) < 0.5f;
+		const vector<T> & first_parent = is_swapped ? parent2 : parent1;
+		const vector<T> & second_parent = is_swapped ? parent1 : parent2;
 
 		// crossover point 1 engine generator
 		static mt19937 random_engine_point1(1);
-		static uniform_int_distribution<int> distrib1(1, TOTAL_LENGTH - 2);
+		uniform_int_distribution<int> distrib1(1, TOTAL_LENGTH - 2);
 		int crossover_point1 = distrib1(random_engine_point1);
 
 		// crossover point 2 engine generator
 		static mt19937 random_engine_point2(2);
-		static uniform_int_distribution<int> distrib2(2, TOTAL_LENGTH - 1);
+		uniform_int_distribution<int> distrib2(2, TOTAL_LENGTH - 1);
 		int crossover_point2 = distrib2(random_engine_point2);
 		/*
 			if(crossover_point1 == crossover_point2)
@@ -136,17 +146,17 @@ vector<T> twoPointCrossover(const vector<T> & parent1, const vector<T> & parent2
 		vector<T> indiv(TOTAL_LENGTH);
 		for(int i = 0; i < crossover_point1; i++)
 		{
-			indiv[i] = parent1[i];
+			indiv[i] = first_parent[i];
 		}
 
 		for(int i = crossover_point1; i < crossover_point2; i++)
 		{
-			indiv[i] = parent2[i];
+			indiv[i] = second_parent[i];
 		}
 
 		for(int i = crossover_point2; i < TOTAL_LENGTH; i++)
 		{
-			indiv[i] = parent1[i];
+			indiv[i] = first_parent[i];
 		}
 
 		return indiv;
@@ -158,6 +168,66 @@ vector<T> twoPointCrossover(const vector<T> & parent1, const vector<T> & parent2
 		return parent1;
 	}
 }
+
+template<typename T, size_t N, typename RandomEngine>
+array<T, N> onePointCrossover(const array<T, N> & parent1, const array<T, N> & parent2,
+		RandomEngine & random_engine)
+{
+	static_assert(N > 1, "one point crossover needs at least 2 alleles");
+
+	// shuffle between first and second parent
+	const bool is_swapped = uniform_int_distribution<int>(0, 1)(random_engine) == 1;
+	const array<T, N> & first_parent = is_swapped ? parent2 : parent1;
+	const array<T, N> & second_parent = is_swapped ? parent1 : parent2;
+
+	const size_t crossover_point1 = uniform_int_distribution<size_t>(1, N - 1)(random_engine);
+
+	array<T, N> indiv = second_parent;
+	for(size_t i = 0; i < crossover_point1; i++)
+	{
+		indiv[i] = first_parent[i];
+	}
+	return indiv;
+}
+
+template<typename T, size_t N, typename RandomEngine>
+array<T, N> twoPointCrossover(const array<T, N> & parent1, const array<T, N> & parent2,
+		RandomEngine & random_engine)
+{
+	static_assert(N > 2, "two point crossover needs at least 3 alleles");
+
+	// shuffle between first and second parent
+	const bool is_swapped = uniform_int_distribution<int>(0, 1)(random_engine) == 1;
+	const array<T, N> & first_parent = is_swapped ? parent2 : parent1;
+	const array<T, N> & second_parent = is_swapped ? parent1 : parent2;
+
+	size_t crossover_point1 = uniform_int_distribution<size_t>(1, N - 2)(random_engine);
+	size_t crossover_point2 = uniform_int_distribution<size_t>(2, N - 1)(random_engine);
+	if(crossover_point1 > crossover_point2)
+	{
+		swap(crossover_point1, crossover_point2);
+	}
+
+	array<T, N> indiv = first_parent;
+	for(size_t i = crossover_point1; i < crossover_point2; i++)
+	{
+		indiv[i] = second_parent[i];
+	}
+	return indiv;
+}
+
+/**
+ * crossovers of common genome types are compiled once in ga_core library
+ * (see PRE-INSTANTIATED GENETIC ALGORITHMS in ga.h)
+ */
+#ifdef GA_CORE_LIBRARY
+extern template vector<int> onePointCrossover(const vector<int> &, const vector<int> &);
+extern template vector<int> twoPointCrossover(const vector<int> &, const vector<int> &);
+extern template vector<double> onePointCrossover(const vector<double> &, const vector<double> &);
+extern template vector<double> twoPointCrossover(const vector<double> &, const vector<double> &);
+extern template vector<bool> onePointCrossover(const vector<bool> &, const vector<bool> &);
+extern template vector<bool> twoPointCrossover(const vector<bool> &, const vector<bool> &);
+#endif
 }
 
 #endif /* CROSSOVERS_H_ */
@@ -0,0 +1,101 @@
+/*
+ * genome_codec.h
+ * Conversion of individuals to bytes and back (for evaluation in other processes)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef GENOME_CODEC_H_
+#define GENOME_CODEC_H_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * GENOME CODEC
+ * ============
+ * encode(indiv, buffer) - append bytes of an individual to buffer
+ * decode(data, end, indiv) - read an individual from bytes in [data, end),
+ *                            move data after its bytes, return false if bytes are invalid
+ *
+ * Bytes are in host byte order, so both processes must run on same kind of machine.
+ * Codecs are provided for trivially copyable types (e.g. a struct of doubles) and
+ * for vectors of trivially copyable types. Other types need a specialization.
+ *
+ */
+template<typename T, typename Enable = void>
+struct genome_codec;
+
+/**
+ * trivially copyable types are copied byte by byte
+ */
+template<typename T>
+struct genome_codec<T, typename enable_if<is_trivially_copyable<T>::value>::type>
+{
+	static void encode(const T & indiv, string & buffer)
+	{
+		buffer.append(reinterpret_cast<const char *>(&indiv), sizeof(T));
+	}
+
+	static bool decode(const char * & data, const char * end, T & indiv)
+	{
+		if(end - data < (ptrdiff_t) sizeof(T))
+		{
+			return false;
+		}
+		memcpy(&indiv, data, sizeof(T));
+		data += sizeof(T);
+		return true;
+	}
+};
+
+/**
+ * vectors are copied as number of elements followed by bytes of elements
+ */
+template<typename U>
+struct genome_codec<vector<U>, typename enable_if<is_trivially_copyable<U>::value>::type>
+{
+	static void encode(const vector<U> & indiv, string & buffer)
+	{
+		const uint64_t size = indiv.size();
+		buffer.append(reinterpret_cast<const char *>(&size), sizeof(size));
+		if(size > 0)
+		{
+			buffer.append(reinterpret_cast<const char *>(indiv.data()), size*sizeof(U));
+		}
+	}
+
+	static bool decode(const char * & data, const char * end, vector<U> & indiv)
+	{
+		uint64_t size;
+		if(end - data < (ptrdiff_t) sizeof(size))
+		{
+			return false;
+		}
+		memcpy(&size, data, sizeof(size));
+		data += sizeof(size);
+
+		if((uint64_t) (end - data)/sizeof(U) < size)
+		{
+			return false;
+		}
+		indiv.resize(size);
+		if(size > 0)
+		{
+			memcpy(indiv.data(), data, size*sizeof(U));
+		}
+		data += size*sizeof(U);
+		return true;
+	}
+};
+}
+
+#endif /* GENOME_CODEC_H_ */
@@ -0,0 +1,112 @@
+/*
+ * genome_hash_set.h
+ * Open addressing hash set of individuals (for finding duplicate offspring)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef GENOME_HASH_SET_H_
+#define GENOME_HASH_SET_H_
+
+#include <cstdint>
+#include <vector>
+#include "util/genome_traits.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * GENOME HASH SET (genome_hash_set)
+ * =================================
+ * Set of pointers to individuals with linear probing, compared with genome_traits.
+ * Each entry also keeps a fitness value and an index given at insertion.
+ *
+ * The set does not own individuals, so they must not change while they are in the set.
+ * clear() is O(1) : entries are marked with the number of clear() calls, and entries
+ * of an older mark are treated as empty (so the table is allocated only once).
+ *
+ */
+template<typename T>
+class genome_hash_set
+{
+public :
+	struct entry
+	{
+		const T * indivP = NULL;
+		uint64_t hash = 0;
+		double fitness = 0;
+		long long index = -1;
+		unsigned mark = 0;
+	};
+
+	/**
+	 * remove all individuals, table has space for at least max_size individuals
+	 */
+	void clear(size_t max_size)
+	{
+		size_t capacity = 16;
+		while(capacity < 2*max_size)
+		{
+			capacity *= 2;
+		}
+
+		if(capacity > entries.size())
+		{
+			entries.assign(capacity, entry());
+			current_mark = 0;
+		}
+
+		if(++current_mark == 0)
+		{
+			// mark wrapped around, old marks have to be removed
+			entries.assign(entries.size(), entry());
+			current_mark = 1;
+		}
+		num_of_entries = 0;
+	}
+
+	/**
+	 * returns entry of an individual equal to given individual if there is one,
+	 * otherwise inserts given individual and returns NULL
+	 */
+	const entry * findOrInsert(const T * indivP, double fitness, long long index)
+	{
+		const uint64_t hash = genome_traits<T>::hash(*indivP);
+		const size_t mask = entries.size() - 1;
+
+		size_t slot = hash & mask;
+		while(entries[slot].mark == current_mark)
+		{
+			const entry & an_entry = entries[slot];
+			if(an_entry.hash == hash && genome_traits<T>::equal(*an_entry.indivP, *indivP))
+			{
+				return &an_entry;
+			}
+			slot = (slot + 1) & mask;
+		}
+
+		entry & new_entry = entries[slot];
+		new_entry.indivP = indivP;
+		new_entry.hash = hash;
+		new_entry.fitness = fitness;
+		new_entry.index = index;
+		new_entry.mark = current_mark;
+		num_of_entries++;
+		return NULL;
+	}
+
+	size_t size()
+	{
+		return num_of_entries;
+	}
+
+private:
+	vector<entry> entries;
+	unsigned current_mark = 0;
+	size_t num_of_entries = 0;
+};
+}
+
+#endif /* GENOME_HASH_SET_H_ */
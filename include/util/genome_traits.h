@@ -0,0 +1,192 @@
+/*
+ * genome_traits.h
+ * Hash, equality and distance of individuals
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef GENOME_TRAITS_H_
+#define GENOME_TRAITS_H_
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include "util/random_engines.h"
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * GENOME TRAITS
+ * =============
+ * is_supported - false if type has no traits (hash, equality and distance are not available)
+ * hash(indiv) - 64-bit hash of an individual
+ * equal(indiv1, indiv2) - true if both individuals are same
+ * distance(indiv1, indiv2) - distance between two individuals
+ *
+ * Traits are provided for :
+ * vectors of numbers - Hamming distance for integers, Euclidean distance for floating points
+ * arrays of numbers (fixed length genomes) - same distances as vectors
+ * trivially copyable types - compared byte by byte, distance is 0 if same else 1
+ *
+ * Other types (or another distance) need a specialization, for example
+ * Euclidean distance of a struct of variables.
+ *
+ */
+template<typename T, typename Enable = void>
+struct genome_traits
+{
+	static const bool is_supported = false;
+
+	static uint64_t hash(const T & indiv) { return 0; }
+	static bool equal(const T & indiv1, const T & indiv2) { return false; }
+	static double distance(const T & indiv1, const T & indiv2) { return 0; }
+};
+
+/**
+ * FNV-1a hash of bytes (scrambled by splitmix64)
+ */
+inline uint64_t hashBytes(const void * data, size_t size)
+{
+	const unsigned char * bytes = static_cast<const unsigned char *>(data);
+	uint64_t hash_value = 0xcbf29ce484222325ULL;
+	for(size_t i = 0; i < size; i++)
+	{
+		hash_value = (hash_value ^ bytes[i])*0x100000001b3ULL;
+	}
+	return splitmix64::mix(hash_value);
+}
+
+/**
+ * true for std::array of numbers (they have their own traits)
+ */
+template<typename T>
+struct is_number_array : false_type { };
+
+template<typename U, size_t N>
+struct is_number_array<array<U, N>> : integral_constant<bool, is_arithmetic<U>::value> { };
+
+template<typename T>
+struct genome_traits<T, typename enable_if<is_trivially_copyable<T>::value
+	&& !is_arithmetic<T>::value && !is_number_array<T>::value>::type>
+{
+	static const bool is_supported = true;
+
+	static uint64_t hash(const T & indiv)
+	{
+		return hashBytes(&indiv, sizeof(T));
+	}
+
+	static bool equal(const T & indiv1, const T & indiv2)
+	{
+		return memcmp(&indiv1, &indiv2, sizeof(T)) == 0;
+	}
+
+	static double distance(const T & indiv1, const T & indiv2)
+	{
+		return equal(indiv1, indiv2) ? 0 : 1;
+	}
+};
+
+template<typename U>
+struct genome_traits<vector<U>, typename enable_if<is_arithmetic<U>::value>::type>
+{
+	static const bool is_supported = true;
+
+	static uint64_t hash(const vector<U> & indiv)
+	{
+		uint64_t hash_value = indiv.size();
+		for(const U & allele : indiv)
+		{
+			hash_value = (hash_value ^ std::hash<U>()(allele))*0x100000001b3ULL;
+		}
+		return splitmix64::mix(hash_value);
+	}
+
+	static bool equal(const vector<U> & indiv1, const vector<U> & indiv2)
+	{
+		return indiv1 == indiv2;
+	}
+
+	/**
+	 * Hamming distance (number of different alleles) for integers,
+	 * Euclidean distance for floating points
+	 */
+	static double distance(const vector<U> & indiv1, const vector<U> & indiv2)
+	{
+		const size_t length = min(indiv1.size(), indiv2.size());
+		double sum = 0;
+		if(is_floating_point<U>::value)
+		{
+			for(size_t i = 0; i < length; i++)
+			{
+				const double difference = indiv1[i] - indiv2[i];
+				sum += difference*difference;
+			}
+			return sqrt(sum);
+		}
+
+		for(size_t i = 0; i < length; i++)
+		{
+			sum += indiv1[i] != indiv2[i];
+		}
+		// extra alleles of longer individual are all different
+		return sum + max(indiv1.size(), indiv2.size()) - length;
+	}
+};
+
+template<typename U, size_t N>
+struct genome_traits<array<U, N>, typename enable_if<is_arithmetic<U>::value>::type>
+{
+	static const bool is_supported = true;
+
+	/**
+	 * same hash as a vector of same alleles
+	 */
+	static uint64_t hash(const array<U, N> & indiv)
+	{
+		uint64_t hash_value = N;
+		for(const U & allele : indiv)
+		{
+			hash_value = (hash_value ^ std::hash<U>()(allele))*0x100000001b3ULL;
+		}
+		return splitmix64::mix(hash_value);
+	}
+
+	static bool equal(const array<U, N> & indiv1, const array<U, N> & indiv2)
+	{
+		return indiv1 == indiv2;
+	}
+
+	/**
+	 * Hamming distance for integers, Euclidean distance for floating points
+	 */
+	static double distance(const array<U, N> & indiv1, const array<U, N> & indiv2)
+	{
+		double sum = 0;
+		if(is_floating_point<U>::value)
+		{
+			for(size_t i = 0; i < N; i++)
+			{
+				const double difference = indiv1[i] - indiv2[i];
+				sum += difference*difference;
+			}
+			return sqrt(sum);
+		}
+
+		for(size_t i = 0; i < N; i++)
+		{
+			sum += indiv1[i] != indiv2[i];
+		}
+		return sum;
+	}
+};
+}
+
+#endif /* GENOME_TRAITS_H_ */
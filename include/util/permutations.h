@@ -0,0 +1,109 @@
+/*
+ * permutations.h
+ * Commonly used operations on permutation individuals
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef PERMUTATIONS_H_
+#define PERMUTATIONS_H_
+
+#include <array>
+#include <vector>
+#include <random>
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * RANDOM PERMUTATION (Fisher-Yates shuffle)
+ * =========================================
+ * fill a container with a random permutation of integers from 0 to (n - 1)
+ * in O(n) time by :
+ * writing integers 0 to (n - 1) in order,
+ * and then swapping each position i (from last to first) with a
+ * uniformly selected position in [0, i]
+ *
+ * Random values are drawn only from the given random engine, so it is safe to call
+ * from different threads as long as each thread uses its own random engine.
+ *
+ */
+template<typename Container, typename RandomEngine>
+void fillRandomPermutation(Container & indiv, size_t n, RandomEngine & random_engine);
+
+/**
+ * fill a fixed length genome with a random permutation of integers from 0 to (N - 1)
+ */
+template<typename U, size_t N, typename RandomEngine>
+void fillRandomPermutation(array<U, N> & indiv, RandomEngine & random_engine);
+
+
+/**
+ * RANDOM PERMUTATION (Fisher-Yates shuffle)
+ * =========================================
+ * create a new vector of integers from 0 to (n - 1) in a random order
+ * (see fillRandomPermutation)
+ *
+ */
+template<typename RandomEngine>
+vector<int> randomPermutation(size_t n, RandomEngine & random_engine);
+
+
+/**
+ * IMPLEMENTATION OF PERMUTATIONS
+ * ==============================
+ */
+
+template<typename Container, typename RandomEngine>
+void fillRandomPermutation(Container & indiv, size_t n, RandomEngine & random_engine)
+{
+	indiv.resize(n);
+	for(size_t i = 0; i < n; i++)
+	{
+		indiv[i] = i;
+	}
+
+	if(n < 2)
+	{
+		return;
+	}
+
+	for(size_t i = n - 1; i > 0; i--)
+	{
+		// select a random position from the positions that are not fixed yet
+		uniform_int_distribution<size_t> distrib_position(0, i);
+		size_t j = distrib_position(random_engine);
+
+		auto temp_value = indiv[i];
+		indiv[i] = indiv[j];
+		indiv[j] = temp_value;
+	}
+}
+
+template<typename U, size_t N, typename RandomEngine>
+void fillRandomPermutation(array<U, N> & indiv, RandomEngine & random_engine)
+{
+	for(size_t i = 0; i < N; i++)
+	{
+		indiv[i] = i;
+	}
+
+	for(size_t i = N - 1; i > 0 && i < N; i--)
+	{
+		uniform_int_distribution<size_t> distrib_position(0, i);
+		swap(indiv[i], indiv[distrib_position(random_engine)]);
+	}
+}
+
+template<typename RandomEngine>
+vector<int> randomPermutation(size_t n, RandomEngine & random_engine)
+{
+	vector<int> indiv;
+	fillRandomPermutation(indiv, n, random_engine);
+	return indiv;
+}
+}
+
+#endif /* PERMUTATIONS_H_ */
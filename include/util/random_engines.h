@@ -0,0 +1,349 @@
+/*
+ * random_engines.h
+ * Small and fast random number engines that can be used by simple_ga
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef RANDOM_ENGINES_H_
+#define RANDOM_ENGINES_H_
+
+#include <cstdint>
+#include <random>
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * RANDOM ENGINES
+ * ==============
+ * Each engine can be used as type parameter RandomEngine of simple_ga
+ * (and with any C++11 random distribution) in place of mt19937 :
+ *
+ * splitmix64   - 8 bytes of state, fastest, mainly used for seeding other engines
+ * xoshiro256ss - 32 bytes of state, period 2^256 - 1, jump() of 2^128 steps
+ * pcg64        - 32 bytes of state, period 2^128, jump() of 2^64 steps (needs 128-bit integers)
+ *
+ * jump() moves an engine ahead to the start of a new non-overlapping sequence,
+ * so copies of one engine can be used as independent streams.
+ *
+ */
+
+/**
+ * SPLITMIX64
+ * ==========
+ * increments a 64-bit state by a fixed odd constant and scrambles it
+ */
+class splitmix64
+{
+public :
+	typedef uint64_t result_type;
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT64_MAX; }
+
+	splitmix64() { }
+	explicit splitmix64(uint64_t seed_value) { seed(seed_value); }
+
+	void seed(uint64_t seed_value = DEFAULT_SEED)
+	{
+		state = seed_value;
+	}
+
+	result_type operator()()
+	{
+		return mix(state += GOLDEN_GAMMA);
+	}
+
+	void discard(unsigned long long num_of_steps)
+	{
+		state += num_of_steps*GOLDEN_GAMMA;
+	}
+
+	/**
+	 * jump ahead 2^48 steps
+	 */
+	void jump()
+	{
+		discard(1ULL << 48);
+	}
+
+	/**
+	 * scramble a 64-bit value (finalizer of splitmix64)
+	 */
+	static uint64_t mix(uint64_t value)
+	{
+		value = (value ^ (value >> 30))*0xbf58476d1ce4e5b9ULL;
+		value = (value ^ (value >> 27))*0x94d049bb133111ebULL;
+		return value ^ (value >> 31);
+	}
+
+	bool operator==(const splitmix64 & other) const { return state == other.state; }
+	bool operator!=(const splitmix64 & other) const { return state != other.state; }
+
+private:
+	static constexpr uint64_t DEFAULT_SEED = 5489;
+	static constexpr uint64_t GOLDEN_GAMMA = 0x9e3779b97f4a7c15ULL;
+
+	uint64_t state = DEFAULT_SEED;
+};
+
+
+/**
+ * XOSHIRO256**
+ * ============
+ * xor/shift/rotate generator with 256 bits of state (Blackman and Vigna)
+ */
+class xoshiro256ss
+{
+public :
+	typedef uint64_t result_type;
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT64_MAX; }
+
+	xoshiro256ss() { seed(); }
+	explicit xoshiro256ss(uint64_t seed_value) { seed(seed_value); }
+
+	/**
+	 * state is filled by splitmix64, so that it is never all zero
+	 */
+	void seed(uint64_t seed_value = 5489)
+	{
+		splitmix64 seeder(seed_value);
+		for(uint64_t & word : state)
+		{
+			word = seeder();
+		}
+	}
+
+	result_type operator()()
+	{
+		const uint64_t result = rotl(state[1]*5, 7)*9;
+		const uint64_t t = state[1] << 17;
+
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+
+		state[2] ^= t;
+		state[3] = rotl(state[3], 45);
+
+		return result;
+	}
+
+	void discard(unsigned long long num_of_steps)
+	{
+		for(; num_of_steps > 0; num_of_steps--)
+		{
+			(*this)();
+		}
+	}
+
+	/**
+	 * jump ahead 2^128 steps (2^128 non-overlapping streams)
+	 */
+	void jump()
+	{
+		static const uint64_t JUMP[] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+				0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+		jump(JUMP);
+	}
+
+	/**
+	 * jump ahead 2^192 steps (2^64 starting points for jump())
+	 */
+	void long_jump()
+	{
+		static const uint64_t LONG_JUMP[] = { 0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL,
+				0x77710069854ee241ULL, 0x39109bb02acbe635ULL };
+		jump(LONG_JUMP);
+	}
+
+	bool operator==(const xoshiro256ss & other) const
+	{
+		return state[0] == other.state[0] && state[1] == other.state[1]
+			&& state[2] == other.state[2] && state[3] == other.state[3];
+	}
+	bool operator!=(const xoshiro256ss & other) const { return !(*this == other); }
+
+private:
+	uint64_t state[4];
+
+	static uint64_t rotl(const uint64_t value, int k)
+	{
+		return (value << k) | (value >> (64 - k));
+	}
+
+	void jump(const uint64_t * jump_polynomial)
+	{
+		uint64_t jumped_state[4] = {0, 0, 0, 0};
+		for(int i = 0; i < 4; i++)
+		{
+			for(int b = 0; b < 64; b++)
+			{
+				if(jump_polynomial[i] & (1ULL << b))
+				{
+					for(int k = 0; k < 4; k++)
+					{
+						jumped_state[k] ^= state[k];
+					}
+				}
+				(*this)();
+			}
+		}
+
+		for(int k = 0; k < 4; k++)
+		{
+			state[k] = jumped_state[k];
+		}
+	}
+};
+
+
+#ifdef __SIZEOF_INT128__
+/**
+ * PCG64
+ * =====
+ * 128-bit linear congruential generator with XSL-RR output permutation (O'Neill)
+ */
+class pcg64
+{
+public :
+	typedef uint64_t result_type;
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return UINT64_MAX; }
+
+	pcg64() { seed(); }
+	explicit pcg64(uint64_t seed_value, uint64_t stream = 0) { seed(seed_value, stream); }
+
+	void seed(uint64_t seed_value = 5489, uint64_t stream = 0)
+	{
+		increment = (((uint128_t) stream) << 1) | 1;
+		state = 0;
+		step();
+		state += seed_value;
+		step();
+	}
+
+	result_type operator()()
+	{
+		step();
+		const uint64_t xored = ((uint64_t) (state >> 64)) ^ ((uint64_t) state);
+		const int rotation = (int) (state >> 122);
+		return (xored >> rotation) | (xored << ((- rotation) & 63));
+	}
+
+	void discard(unsigned long long num_of_steps)
+	{
+		advance(num_of_steps);
+	}
+
+	/**
+	 * jump ahead 2^64 steps (2^64 non-overlapping streams)
+	 */
+	void jump()
+	{
+		advance(((uint128_t) 1) << 64);
+	}
+
+	/**
+	 * move ahead given number of steps in O(log(num_of_steps)) (Brown's algorithm)
+	 */
+	void advance(unsigned __int128 num_of_steps)
+	{
+		uint128_t accumulated_multiplier = 1, accumulated_increment = 0;
+		uint128_t current_multiplier = multiplier(), current_increment = increment;
+		while(num_of_steps > 0)
+		{
+			if(num_of_steps & 1)
+			{
+				accumulated_multiplier *= current_multiplier;
+				accumulated_increment = accumulated_increment*current_multiplier
+						+ current_increment;
+			}
+			current_increment = (current_multiplier + 1)*current_increment;
+			current_multiplier *= current_multiplier;
+			num_of_steps >>= 1;
+		}
+		state = accumulated_multiplier*state + accumulated_increment;
+	}
+
+	bool operator==(const pcg64 & other) const
+	{
+		return state == other.state && increment == other.increment;
+	}
+	bool operator!=(const pcg64 & other) const { return !(*this == other); }
+
+private:
+	typedef unsigned __int128 uint128_t;
+
+	uint128_t state;
+	uint128_t increment;
+
+	static uint128_t multiplier()
+	{
+		return (((uint128_t) 0x2360ed051fc65da4ULL) << 64) | 0x4385df649fccf645ULL;
+	}
+
+	void step()
+	{
+		state = state*multiplier() + increment;
+	}
+};
+#endif
+
+
+/**
+ * RANDOM ENGINE TRAITS
+ * ====================
+ * create an engine from a 64-bit seed and jump it to an independent stream.
+ * Engines of standard library do not support jump, so they are
+ * reseeded from their own output (scrambled by splitmix64).
+ */
+template<typename RandomEngine>
+struct random_engine_traits
+{
+	static RandomEngine create(uint64_t seed_value)
+	{
+		seed_seq seed_sequence {(uint32_t) seed_value, (uint32_t) (seed_value >> 32)};
+		return RandomEngine(seed_sequence);
+	}
+
+	static void jump(RandomEngine & random_engine)
+	{
+		const uint64_t high_bits = random_engine();
+		const uint64_t next_seed = splitmix64::mix((high_bits << 32) ^ random_engine());
+		random_engine = create(next_seed);
+	}
+};
+
+template<>
+struct random_engine_traits<splitmix64>
+{
+	static splitmix64 create(uint64_t seed_value) { return splitmix64(seed_value); }
+	static void jump(splitmix64 & random_engine) { random_engine.jump(); }
+};
+
+template<>
+struct random_engine_traits<xoshiro256ss>
+{
+	static xoshiro256ss create(uint64_t seed_value) { return xoshiro256ss(seed_value); }
+	static void jump(xoshiro256ss & random_engine) { random_engine.jump(); }
+};
+
+#ifdef __SIZEOF_INT128__
+template<>
+struct random_engine_traits<pcg64>
+{
+	static pcg64 create(uint64_t seed_value) { return pcg64(seed_value); }
+	static void jump(pcg64 & random_engine) { random_engine.jump(); }
+};
+#endif
+}
+
+#endif /* RANDOM_ENGINES_H_ */
@@ -0,0 +1,384 @@
+/*
+ * telemetry_ring.h
+ * Per generation statistics written to a memory mapped ring buffer file
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef TELEMETRY_RING_H_
+#define TELEMETRY_RING_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * statistics of one generation (a fixed size binary record)
+ */
+struct telemetry_record
+{
+	int64_t generation = 0;
+	uint64_t num_of_evaluations = 0;
+	double elapsed_seconds = 0;
+	double best_fitness = 0;
+	double gen_best_fitness = 0;
+	double avg_fitness = 0;
+	double gen_min_fitness = 0;
+	double fitness_sum = 0;
+	double fitness_variance = 0;
+};
+
+/**
+ * TELEMETRY RING BUFFER FILE
+ * ==========================
+ * A file of a header and a fixed number of slots, each slot has one telemetry_record.
+ * Record number k (0, 1, 2, ...) is written in slot k % capacity, so the file keeps
+ * the last capacity records. Writer (telemetry_writer) and readers (telemetry_reader)
+ * map the file in memory and never lock each other :
+ *
+ * Each slot has a sequence number (seqlock). Writer sets it to 2k + 1 before writing
+ * record k and to 2k + 2 after it. A reader copies a slot and accepts the copy only if
+ * sequence was 2k + 2 both before and after copying, otherwise record k is being
+ * written (try again later) or was already overwritten by a newer record (it is lost).
+ * Values of a slot are atomic words, so a copy during writing is not a data race.
+ *
+ * Header has total number of written records (so readers know where writer is)
+ * and a flag set by writer when it is closed.
+ *
+ * Writer is a single thread (GA). Slots are 128 bytes (2 cache lines), a generation
+ * costs a few atomic stores and no system call or formatting.
+ *
+ */
+namespace telemetry_layout
+{
+	const uint64_t MAGIC = 0x4741544c4d545259ULL; // "GATLMTRY"
+	const uint32_t VERSION = 1;
+	const size_t HEADER_SIZE = 128;
+	const size_t SLOT_WORDS = 16;
+	const size_t RECORD_WORDS = sizeof(telemetry_record)/sizeof(uint64_t);
+
+	static_assert(sizeof(telemetry_record) % sizeof(uint64_t) == 0
+			&& RECORD_WORDS < SLOT_WORDS, "telemetry record must fit words of a slot");
+	static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "64 bit atomics must be lock free in shared memory");
+
+	struct header
+	{
+		atomic<uint64_t> magic;
+		uint32_t version;
+		uint32_t record_size;
+		uint64_t capacity;
+		atomic<uint64_t> num_of_records;
+		atomic<uint32_t> is_closed;
+	};
+
+	struct slot
+	{
+		atomic<uint64_t> sequence;
+		atomic<uint64_t> words[SLOT_WORDS - 1];
+	};
+
+	static_assert(sizeof(header) <= HEADER_SIZE, "telemetry header must fit its size");
+	static_assert(sizeof(slot) == SLOT_WORDS*sizeof(uint64_t), "telemetry slot must have no padding");
+
+	inline size_t fileSize(uint64_t capacity)
+	{
+		return HEADER_SIZE + capacity*sizeof(slot);
+	}
+
+	inline slot * getSlots(void * mapping)
+	{
+		return reinterpret_cast<slot *>(static_cast<char *>(mapping) + HEADER_SIZE);
+	}
+}
+
+/**
+ * TELEMETRY WRITER (telemetry_writer)
+ * ===================================
+ * Creates (or replaces) a ring buffer file with room for capacity records,
+ * and appends records to it. An existing file is replaced by renaming a new file
+ * over it (readers of the old file are not affected). isOpen() is false if file could not be created.
+ * Not thread safe (one writer per file).
+ *
+ */
+class telemetry_writer
+{
+public :
+	telemetry_writer(const string & path, uint64_t capacity = 4096)
+	{
+		if(capacity < 1)
+		{
+			cerr<<"error telemetry capacity : "<<capacity<<" (capacity < 1 is not allowed)."
+					<<" keeping capacity 1"<<endl;
+			capacity = 1;
+		}
+
+		// a new file is renamed over an existing one instead of truncating it,
+		// so readers that still map the old file keep reading it safely
+		const string new_path = path + ".new." + to_string(getpid());
+		const int fd = open(new_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+		if(fd < 0)
+		{
+			cerr<<"error creating telemetry file : "<<new_path<<endl;
+			return;
+		}
+
+		const size_t file_size = telemetry_layout::fileSize(capacity);
+		if(ftruncate(fd, file_size) == 0)
+		{
+			void * mapping = mmap(NULL, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			if(mapping != MAP_FAILED)
+			{
+				mappingP = mapping;
+				mapping_size = file_size;
+			}
+		}
+		close(fd);
+
+		if(mappingP == NULL)
+		{
+			cerr<<"error mapping telemetry file : "<<new_path<<endl;
+			unlink(new_path.c_str());
+			return;
+		}
+
+		// new file is all zeros, so sequences and counters start at 0
+		headerP = static_cast<telemetry_layout::header *>(mappingP);
+		slots = telemetry_layout::getSlots(mappingP);
+		headerP->version = telemetry_layout::VERSION;
+		headerP->record_size = sizeof(telemetry_record);
+		headerP->capacity = capacity;
+		// magic is written last, a reader does not use file before it is set
+		headerP->magic.store(telemetry_layout::MAGIC, memory_order_release);
+
+		if(rename(new_path.c_str(), path.c_str()) != 0)
+		{
+			cerr<<"error replacing telemetry file : "<<path<<endl;
+			unlink(new_path.c_str());
+			munmap(mappingP, mapping_size);
+			mappingP = NULL;
+			headerP = NULL;
+			slots = NULL;
+		}
+	}
+
+	~telemetry_writer()
+	{
+		if(mappingP != NULL)
+		{
+			headerP->is_closed.store(1, memory_order_release);
+			munmap(mappingP, mapping_size);
+		}
+	}
+
+	bool isOpen()
+	{
+		return mappingP != NULL;
+	}
+
+	/**
+	 * write a record in next slot (overwriting oldest record when ring is full)
+	 */
+	void append(const telemetry_record & record)
+	{
+		if(mappingP == NULL)
+		{
+			return;
+		}
+
+		uint64_t words[telemetry_layout::RECORD_WORDS];
+		memcpy(words, &record, sizeof(record));
+
+		const uint64_t record_number = headerP->num_of_records.load(memory_order_relaxed);
+		telemetry_layout::slot & _slot = slots[record_number % headerP->capacity];
+
+		_slot.sequence.store(2*record_number + 1, memory_order_relaxed);
+		// values must not be seen before sequence says slot is being written
+		atomic_thread_fence(memory_order_release);
+		for(size_t w = 0; w < telemetry_layout::RECORD_WORDS; w++)
+		{
+			_slot.words[w].store(words[w], memory_order_relaxed);
+		}
+		_slot.sequence.store(2*record_number + 2, memory_order_release);
+
+		headerP->num_of_records.store(record_number + 1, memory_order_release);
+	}
+
+private:
+	void * mappingP = NULL;
+	size_t mapping_size = 0;
+	telemetry_layout::header * headerP = NULL;
+	telemetry_layout::slot * slots = NULL;
+
+	// non-copyable since it owns the mapping
+	telemetry_writer(const telemetry_writer & _telemetry_writer);
+	telemetry_writer & operator=(const telemetry_writer & _telemetry_writer);
+};
+
+/**
+ * TELEMETRY READER (telemetry_reader)
+ * ===================================
+ * Maps a ring buffer file (read only) and reads records that are new since last read.
+ * Reading starts from oldest record still in file. Records overwritten by writer
+ * before they were read are counted as lost.
+ *
+ */
+class telemetry_reader
+{
+public :
+	explicit telemetry_reader(const string & path)
+	{
+		const int fd = open(path.c_str(), O_RDONLY);
+		if(fd < 0)
+		{
+			cerr<<"error opening telemetry file : "<<path<<endl;
+			return;
+		}
+
+		struct stat file_stat;
+		if(fstat(fd, &file_stat) == 0 && (size_t) file_stat.st_size >= telemetry_layout::HEADER_SIZE)
+		{
+			void * mapping = mmap(NULL, file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+			if(mapping != MAP_FAILED)
+			{
+				mappingP = mapping;
+				mapping_size = file_stat.st_size;
+			}
+		}
+		close(fd);
+
+		if(mappingP == NULL)
+		{
+			cerr<<"error mapping telemetry file : "<<path<<endl;
+			return;
+		}
+
+		headerP = static_cast<const telemetry_layout::header *>(mappingP);
+		slots = telemetry_layout::getSlots(mappingP);
+	}
+
+	~telemetry_reader()
+	{
+		if(mappingP != NULL)
+		{
+			munmap(mappingP, mapping_size);
+		}
+	}
+
+	/**
+	 * true when file is mapped and its header is written by a writer
+	 * (a file that is just created may not be ready yet)
+	 */
+	bool isReady()
+	{
+		if(mappingP == NULL
+				|| headerP->magic.load(memory_order_acquire) != telemetry_layout::MAGIC)
+		{
+			return false;
+		}
+		if(headerP->version != telemetry_layout::VERSION
+				|| headerP->record_size != sizeof(telemetry_record)
+				|| telemetry_layout::fileSize(headerP->capacity) > mapping_size)
+		{
+			cerr<<"error telemetry file has a different format (version "
+					<<headerP->version<<")"<<endl;
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	 * append records written since last read to records, returns number of them
+	 */
+	size_t read(vector<telemetry_record> & records)
+	{
+		if(!isReady())
+		{
+			return 0;
+		}
+
+		const uint64_t capacity = headerP->capacity;
+		const uint64_t num_of_records = headerP->num_of_records.load(memory_order_acquire);
+		size_t num_of_read_records = 0;
+		uint64_t words[telemetry_layout::RECORD_WORDS];
+		while(next_record < num_of_records)
+		{
+			// skip records that are already overwritten
+			if(num_of_records - next_record > capacity)
+			{
+				num_of_lost_records += num_of_records - capacity - next_record;
+				next_record = num_of_records - capacity;
+			}
+
+			const telemetry_layout::slot & _slot = slots[next_record % capacity];
+			const uint64_t expected_sequence = 2*next_record + 2;
+			const uint64_t sequence_before = _slot.sequence.load(memory_order_acquire);
+			for(size_t w = 0; w < telemetry_layout::RECORD_WORDS; w++)
+			{
+				words[w] = _slot.words[w].load(memory_order_relaxed);
+			}
+			atomic_thread_fence(memory_order_acquire);
+			const uint64_t sequence_after = _slot.sequence.load(memory_order_relaxed);
+
+			if(sequence_before == expected_sequence && sequence_after == expected_sequence)
+			{
+				records.push_back(telemetry_record());
+				memcpy(&records.back(), words, sizeof(telemetry_record));
+				num_of_read_records++;
+			}
+			else if(sequence_before < expected_sequence)
+			{
+				// not written yet (writer has not finished it)
+				break;
+			}
+			else
+			{
+				// being overwritten by a newer record
+				num_of_lost_records++;
+			}
+			next_record++;
+		}
+		return num_of_read_records;
+	}
+
+	/**
+	 * true when writer has closed the file (no more records will be written)
+	 */
+	bool isClosed()
+	{
+		return isReady() && headerP->is_closed.load(memory_order_acquire) != 0;
+	}
+
+	uint64_t getNumOfLostRecords()
+	{
+		return num_of_lost_records;
+	}
+
+private:
+	void * mappingP = NULL;
+	size_t mapping_size = 0;
+	const telemetry_layout::header * headerP = NULL;
+	const telemetry_layout::slot * slots = NULL;
+
+	uint64_t next_record = 0;
+	uint64_t num_of_lost_records = 0;
+
+	// non-copyable since it owns the mapping
+	telemetry_reader(const telemetry_reader & _telemetry_reader);
+	telemetry_reader & operator=(const telemetry_reader & _telemetry_reader);
+};
+}
+
+#endif /* TELEMETRY_RING_H_ */
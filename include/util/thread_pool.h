@@ -0,0 +1,135 @@
+/*
+ * thread_pool.h
+ * A fixed size pool of threads for running tasks of GA
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef THREAD_POOL_H_
+#define THREAD_POOL_H_
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * THREAD POOL (thread_pool)
+ * =========================
+ * Runs submitted tasks on a fixed number of threads, in order of submission.
+ * submit() returns a future for the result of a task.
+ *
+ * Destructor waits for all submitted tasks to finish.
+ *
+ */
+class thread_pool
+{
+public :
+	explicit thread_pool(unsigned num_of_threads)
+	{
+		if(num_of_threads < 1)
+		{
+			num_of_threads = 1;
+		}
+
+		for(unsigned t = 0; t < num_of_threads; t++)
+		{
+			threads.push_back(thread(&thread_pool::runTasks, this));
+		}
+	}
+
+	~thread_pool()
+	{
+		{
+			lock_guard<mutex> lock(tasks_mutex);
+			stopping = true;
+		}
+		tasks_available.notify_all();
+
+		for(thread & a_thread : threads)
+		{
+			a_thread.join();
+		}
+	}
+
+	/**
+	 * add a task to run, returns future for result of the task
+	 */
+	template<typename Task>
+	future<typename result_of<Task()>::type> submit(Task task)
+	{
+		typedef typename result_of<Task()>::type result_type;
+
+		// packaged task is not copyable, so it is shared with the queued function
+		shared_ptr<packaged_task<result_type()>> packaged_taskP =
+			make_shared<packaged_task<result_type()>>(task);
+		future<result_type> result = packaged_taskP->get_future();
+
+		execute([packaged_taskP]() { (*packaged_taskP)(); });
+		return result;
+	}
+
+	/**
+	 * add a task to run, without a future for its result
+	 */
+	void execute(const function<void()> & task)
+	{
+		{
+			lock_guard<mutex> lock(tasks_mutex);
+			tasks.push_back(task);
+		}
+		tasks_available.notify_one();
+	}
+
+	unsigned getNumOfThreads()
+	{
+		return threads.size();
+	}
+
+private:
+	vector<thread> threads;
+
+	deque<function<void()>> tasks;
+	mutex tasks_mutex;
+	condition_variable tasks_available;
+	bool stopping = false;
+
+	// non-copyable since it owns threads
+	thread_pool(const thread_pool & _thread_pool);
+	thread_pool & operator=(const thread_pool & _thread_pool);
+
+	/**
+	 * run tasks until pool is stopped and no task is left
+	 */
+	void runTasks()
+	{
+		while(true)
+		{
+			function<void()> task;
+			{
+				unique_lock<mutex> lock(tasks_mutex);
+				tasks_available.wait(lock, [this]() { return stopping || !tasks.empty(); });
+				if(tasks.empty())
+				{
+					return;
+				}
+				task = std::move(tasks.front());
+				tasks.pop_front();
+			}
+			task();
+		}
+	}
+};
+}
+
+#endif /* THREAD_POOL_H_ */
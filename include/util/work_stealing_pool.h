@@ -0,0 +1,219 @@
+/*
+ * work_stealing_pool.h
+ * A pool of threads with a task queue per thread, idle threads steal tasks of others
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef WORK_STEALING_POOL_H_
+#define WORK_STEALING_POOL_H_
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+using namespace std;
+
+namespace ga
+{
+/**
+ * WORK STEALING POOL (work_stealing_pool)
+ * =======================================
+ * Each thread has its own queue of tasks. Tasks added from outside the pool are
+ * given to queues in turn, tasks added by a task go to queue of its own thread.
+ * A thread takes newest task of its own queue first, and when its queue is empty
+ * it steals oldest task of another queue, so all threads are busy until
+ * the last task is taken (also when tasks take very different time).
+ *
+ * wait() blocks until all added tasks are finished.
+ * Destructor waits for all added tasks to finish.
+ *
+ */
+class work_stealing_pool
+{
+public :
+	explicit work_stealing_pool(unsigned num_of_threads)
+	{
+		if(num_of_threads < 1)
+		{
+			num_of_threads = 1;
+		}
+
+		for(unsigned t = 0; t < num_of_threads; t++)
+		{
+			queues.push_back(unique_ptr<task_queue>(new task_queue));
+		}
+		for(unsigned t = 0; t < num_of_threads; t++)
+		{
+			threads.push_back(thread(&work_stealing_pool::runTasks, this, t));
+		}
+	}
+
+	~work_stealing_pool()
+	{
+		{
+			lock_guard<mutex> lock(state_mutex);
+			stopping = true;
+		}
+		tasks_available.notify_all();
+
+		for(thread & a_thread : threads)
+		{
+			a_thread.join();
+		}
+	}
+
+	/**
+	 * add a task to run
+	 */
+	void execute(const function<void()> & task)
+	{
+		const worker_identity & worker = currentWorker();
+		const size_t queue_index = worker.poolP == this ? worker.index
+			: next_queue.fetch_add(1, memory_order_relaxed) % queues.size();
+		// counted with state mutex held, so that no waiting thread misses it,
+		// and before it is queued, so that a thread taking it never counts below 0
+		{
+			lock_guard<mutex> lock(state_mutex);
+			num_of_queued_tasks++;
+			num_of_pending_tasks++;
+		}
+		{
+			lock_guard<mutex> lock(queues[queue_index]->queue_mutex);
+			queues[queue_index]->tasks.push_back(task);
+		}
+		tasks_available.notify_one();
+	}
+
+	/**
+	 * wait until all added tasks are finished
+	 * (must not be called from a task of this pool)
+	 */
+	void wait()
+	{
+		unique_lock<mutex> lock(state_mutex);
+		all_finished.wait(lock, [this]() { return num_of_pending_tasks == 0; });
+	}
+
+	unsigned getNumOfThreads()
+	{
+		return threads.size();
+	}
+
+	/**
+	 * number of tasks taken from queue of another thread
+	 */
+	unsigned long long getNumOfSteals()
+	{
+		return num_of_steals;
+	}
+
+private:
+	struct task_queue
+	{
+		mutex queue_mutex;
+		deque<function<void()>> tasks;
+	};
+
+	// pool and queue of the calling thread (if it is a thread of a pool)
+	struct worker_identity
+	{
+		work_stealing_pool * poolP = NULL;
+		size_t index = 0;
+	};
+
+	vector<unique_ptr<task_queue>> queues;
+	vector<thread> threads;
+	atomic<size_t> next_queue {0};
+	atomic<unsigned long long> num_of_steals {0};
+
+	mutex state_mutex;
+	condition_variable tasks_available;
+	condition_variable all_finished;
+	// tasks in queues, and tasks in queues or running
+	atomic<size_t> num_of_queued_tasks {0};
+	size_t num_of_pending_tasks = 0;
+	bool stopping = false;
+
+	// non-copyable since it owns threads
+	work_stealing_pool(const work_stealing_pool & _work_stealing_pool);
+	work_stealing_pool & operator=(const work_stealing_pool & _work_stealing_pool);
+
+	static worker_identity & currentWorker()
+	{
+		static thread_local worker_identity identity;
+		return identity;
+	}
+
+	/**
+	 * take newest task of own queue, or oldest task of another queue
+	 */
+	bool takeTask(size_t index, function<void()> & task)
+	{
+		for(size_t k = 0; k < queues.size(); k++)
+		{
+			task_queue & queue = *queues[(index + k) % queues.size()];
+			lock_guard<mutex> lock(queue.queue_mutex);
+			if(!queue.tasks.empty())
+			{
+				if(k == 0)
+				{
+					task = std::move(queue.tasks.back());
+					queue.tasks.pop_back();
+				}
+				else
+				{
+					task = std::move(queue.tasks.front());
+					queue.tasks.pop_front();
+					num_of_steals++;
+				}
+				num_of_queued_tasks--;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * run tasks until pool is stopped and no task is left
+	 */
+	void runTasks(size_t index)
+	{
+		worker_identity & worker = currentWorker();
+		worker.poolP = this;
+		worker.index = index;
+
+		function<void()> task;
+		while(true)
+		{
+			if(takeTask(index, task))
+			{
+				task();
+				task = nullptr;
+
+				lock_guard<mutex> lock(state_mutex);
+				if(--num_of_pending_tasks == 0)
+				{
+					all_finished.notify_all();
+				}
+				continue;
+			}
+
+			unique_lock<mutex> lock(state_mutex);
+			tasks_available.wait(lock, [this]() { return stopping || num_of_queued_tasks > 0; });
+			if(stopping && num_of_queued_tasks == 0)
+			{
+				return;
+			}
+		}
+	}
+};
+}
+
+#endif /* WORK_STEALING_POOL_H_ */
@@ -0,0 +1,270 @@
+/*
+ * bench_json.h
+ * A small JSON reader for baseline files of benchmarks
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef BENCH_JSON_H_
+#define BENCH_JSON_H_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <cmath>
+
+using namespace std;
+
+/**
+ * JSON VALUE (json_value)
+ * =======================
+ * A parsed JSON value : null, bool, number, string, array or object.
+ * Members of an object are kept in a map (order is not kept).
+ * Missing members and wrong types give a null value, so that
+ * optional values of a baseline can be read without checks.
+ *
+ */
+struct json_value
+{
+	enum json_type { NULL_VALUE, BOOL_VALUE, NUMBER_VALUE, STRING_VALUE, ARRAY_VALUE, OBJECT_VALUE };
+
+	json_type type = NULL_VALUE;
+	bool bool_value = false;
+	double number_value = 0;
+	string string_value;
+	vector<json_value> array_values;
+	map<string, json_value> object_values;
+
+	bool isNull() const
+	{
+		return type == NULL_VALUE;
+	}
+
+	/**
+	 * member of an object (null value if there is no such member)
+	 */
+	const json_value & operator[](const string & name) const
+	{
+		static const json_value null_value;
+		map<string, json_value>::const_iterator member = object_values.find(name);
+		return member == object_values.end() ? null_value : member->second;
+	}
+
+	/**
+	 * number value, or default_value if it is not a number (e.g. null)
+	 */
+	double getNumber(double default_value = NAN) const
+	{
+		return type == NUMBER_VALUE ? number_value : default_value;
+	}
+};
+
+/**
+ * JSON READER (json_reader)
+ * =========================
+ * Parses text of a JSON document. parse() returns false (with position of error)
+ * if text is not valid JSON. \u escapes of strings are kept as they are.
+ *
+ */
+class json_reader
+{
+public :
+	bool parse(const string & text, json_value & value)
+	{
+		textP = &text;
+		position = 0;
+		if(!parseValue(value))
+		{
+			return false;
+		}
+		skipSpaces();
+		return position == text.size();
+	}
+
+	size_t getErrorPosition()
+	{
+		return position;
+	}
+
+private:
+	const string * textP = NULL;
+	size_t position = 0;
+
+	void skipSpaces()
+	{
+		while(position < textP->size() && isspace((unsigned char) (*textP)[position]))
+		{
+			position++;
+		}
+	}
+
+	bool consume(const char * word)
+	{
+		const size_t length = strlen(word);
+		if(textP->compare(position, length, word) != 0)
+		{
+			return false;
+		}
+		position += length;
+		return true;
+	}
+
+	bool parseValue(json_value & value)
+	{
+		skipSpaces();
+		if(position >= textP->size())
+		{
+			return false;
+		}
+
+		const char c = (*textP)[position];
+		if(c == '{')
+		{
+			return parseObject(value);
+		}
+		else if(c == '[')
+		{
+			return parseArray(value);
+		}
+		else if(c == '"')
+		{
+			value.type = json_value::STRING_VALUE;
+			return parseString(value.string_value);
+		}
+		else if(consume("true"))
+		{
+			value.type = json_value::BOOL_VALUE;
+			value.bool_value = true;
+			return true;
+		}
+		else if(consume("false"))
+		{
+			value.type = json_value::BOOL_VALUE;
+			value.bool_value = false;
+			return true;
+		}
+		else if(consume("null"))
+		{
+			value.type = json_value::NULL_VALUE;
+			return true;
+		}
+
+		// number
+		const char * start = textP->c_str() + position;
+		char * end;
+		value.number_value = strtod(start, &end);
+		if(end == start)
+		{
+			return false;
+		}
+		value.type = json_value::NUMBER_VALUE;
+		position += end - start;
+		return true;
+	}
+
+	bool parseString(string & result)
+	{
+		// opening quote
+		position++;
+		result.clear();
+		while(position < textP->size())
+		{
+			char c = (*textP)[position++];
+			if(c == '"')
+			{
+				return true;
+			}
+			if(c == '\\' && position < textP->size())
+			{
+				c = (*textP)[position++];
+				switch(c)
+				{
+				case 'n': result += '\n'; break;
+				case 't': result += '\t'; break;
+				case 'r': result += '\r'; break;
+				case 'b': result += '\b'; break;
+				case 'f': result += '\f'; break;
+				case 'u': result += "\\u"; break;
+				default: result += c;
+				}
+			}
+			else
+			{
+				result += c;
+			}
+		}
+		return false;
+	}
+
+	bool parseArray(json_value & value)
+	{
+		value.type = json_value::ARRAY_VALUE;
+		// opening bracket
+		position++;
+		skipSpaces();
+		if(consume("]"))
+		{
+			return true;
+		}
+
+		while(true)
+		{
+			value.array_values.push_back(json_value());
+			if(!parseValue(value.array_values.back()))
+			{
+				return false;
+			}
+			skipSpaces();
+			if(consume("]"))
+			{
+				return true;
+			}
+			if(!consume(","))
+			{
+				return false;
+			}
+		}
+	}
+
+	bool parseObject(json_value & value)
+	{
+		value.type = json_value::OBJECT_VALUE;
+		// opening brace
+		position++;
+		skipSpaces();
+		if(consume("}"))
+		{
+			return true;
+		}
+
+		string name;
+		while(true)
+		{
+			skipSpaces();
+			if(position >= textP->size() || (*textP)[position] != '"' || !parseString(name))
+			{
+				return false;
+			}
+			skipSpaces();
+			if(!consume(":") || !parseValue(value.object_values[name]))
+			{
+				return false;
+			}
+			skipSpaces();
+			if(consume("}"))
+			{
+				return true;
+			}
+			if(!consume(","))
+			{
+				return false;
+			}
+		}
+	}
+};
+
+#endif /* BENCH_JSON_H_ */
@@ -0,0 +1,456 @@
+/*
+ * ga_e2e_bench.cpp
+ * End-to-end time-to-solution benchmark of the examples, compared with a baseline
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#define _USE_MATH_DEFINES
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <functional>
+#include <chrono>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include "nqueen_ga.h"
+#include "function_minimizer_ga.h"
+#include "bench_json.h"
+
+using namespace std;
+
+/**
+ * END-TO-END BENCHMARK (ga_e2e_bench)
+ * ===================================
+ * Runs N-Queen example (N = 20, 50, 100) and the three math function demos
+ * (McCormick, Schaffer N.4, Cross-In-Tray) with their demo settings and fixed seeds,
+ * each until its target fitness or maximum number of generations. For each one it
+ * records wall time, number of evaluations, generations to target, peak RSS and
+ * final (best) fitness.
+ *
+ * Each benchmark is run in its own child process, so that its peak RSS is its own
+ * and one benchmark does not warm up another.
+ *
+ * Results are compared with a baseline JSON and the program fails (exit code 1)
+ * when any of them is worse than baseline beyond tolerance of baseline :
+ *     wall time, evaluations, generations, peak RSS - more than relative tolerance
+ *     (time and RSS also have an absolute slack, since small values are noisy)
+ *     final fitness - less than baseline by more than absolute tolerance
+ * A benchmark that reached its target in baseline must reach it again.
+ *
+ * USAGE
+ * ga_e2e_bench [--baseline FILE] [--output FILE] [--write-baseline FILE] [--filter TEXT]
+ *   --baseline FILE       compare with this baseline (default : no comparison)
+ *   --output FILE         write results as JSON to FILE (default : standard output)
+ *   --write-baseline FILE write results with default tolerances as a new baseline
+ *   --filter TEXT         run only benchmarks whose name contains TEXT
+ *
+ * Wall time and peak RSS depend on machine, so a baseline should be written on the
+ * machine (and build type) it is compared on.
+ *
+ */
+
+double mccormick_func(double x, double y)
+{
+	return sin(x + y) + pow((x - y), 2) - 1.5*x + 2.5*y + 1;
+}
+
+double schaffer_n4_func(double x, double y)
+{
+	return 0.5 + ((pow(cos(sin(abs(pow(x, 2) - pow(y, 2)))), 2) - 0.5) /
+			(pow((1 + (0.001*(pow(x, 2) + pow(y, 2)))), 2)));
+}
+
+double cross_in_tray_func(double x, double y)
+{
+	return -0.0001*(pow(((abs(sin(x) * sin(y) * exp(abs(100 -
+			((sqrt(pow(x, 2) + pow(y, 2))) / M_PI))))) + 1), 0.1));
+}
+
+/**
+ * measurements of a benchmark (plain values, so it can be sent through a pipe)
+ */
+struct bench_result
+{
+	bool completed = false;
+	double wall_seconds = 0;
+	unsigned long long num_of_evaluations = 0;
+	int num_of_generations = 0;
+	// -1 if target was not reached
+	int generations_to_target = -1;
+	long peak_rss_kb = 0;
+	double final_fitness = 0;
+};
+
+struct benchmark
+{
+	string name;
+	function<void(bench_result &)> run;
+};
+
+/**
+ * allowed regression (relative to baseline, or absolute for slack and fitness)
+ */
+struct bench_tolerances
+{
+	double wall_time = 0.25;
+	double wall_time_slack_seconds = 0.05;
+	double evaluations = 0.05;
+	double generations = 0.05;
+	double peak_rss = 0.25;
+	double peak_rss_slack_kb = 2048;
+	double fitness = 1e-9;
+};
+
+const uint64_t SEED = 5489;
+
+/**
+ * run a GA with its demo settings until target fitness, and note its statistics
+ */
+template<typename GA>
+void runGA(GA & _ga, double target_fitness, bench_result & result)
+{
+	_ga.setVerbose(false);
+	_ga.setSeed(SEED);
+	_ga.setStoppingCriterion(stopOnTarget(target_fitness));
+
+	const chrono::steady_clock::time_point start_time = chrono::steady_clock::now();
+	_ga.run();
+	result.wall_seconds = chrono::duration<double>(chrono::steady_clock::now() - start_time).count();
+
+	const ga_statistics & statistics = _ga.getStatistics();
+	result.num_of_evaluations = statistics.num_of_evaluations;
+	result.num_of_generations = statistics.num_of_generations;
+	result.final_fitness = _ga.getBestFitness();
+	result.generations_to_target = result.final_fitness >= target_fitness ?
+			(int) statistics.best_fitness_generation : -1;
+}
+
+vector<benchmark> getBenchmarks()
+{
+	vector<benchmark> benchmarks;
+
+	for(int n : {20, 50, 100})
+	{
+		benchmarks.push_back({"nqueen_" + to_string(n), [n](bench_result & result)
+		{
+			// settings of N-Queen demo
+			nqueen_genetic_algo _nqueen_genetic_algo(n);
+			_nqueen_genetic_algo.setParameters(100, 2000, 0.9, 0.1, 0.03, true);
+			_nqueen_genetic_algo.setDuplicateElimination(true);
+			runGA(_nqueen_genetic_algo, 0, result);
+		}});
+	}
+
+	// minimum of function is reached within 1e-4
+	benchmarks.push_back({"mccormick", [](bench_result & result)
+	{
+		function_minimizer_ga _function_minimizer_ga(&mccormick_func, -1.5, -3, 4, 4);
+		_function_minimizer_ga.setParameters(100, 1000, 0.9, 0.005, -1, true);
+		runGA(_function_minimizer_ga, -(-1.913222954981037 + 1e-4), result);
+	}});
+
+	benchmarks.push_back({"schaffer_n4", [](bench_result & result)
+	{
+		function_minimizer_ga _function_minimizer_ga(&schaffer_n4_func, -100, 100);
+		_function_minimizer_ga.setParameters(100, 2000, 0.5, 0.025, -1, true);
+		runGA(_function_minimizer_ga, -(0.292578632035980 + 1e-4), result);
+	}});
+
+	benchmarks.push_back({"cross_in_tray", [](bench_result & result)
+	{
+		function_minimizer_ga _function_minimizer_ga(&cross_in_tray_func, -10.0, 10.0);
+		_function_minimizer_ga.setParameters(100, 1000, 0.65, 0.005, -1, true);
+		runGA(_function_minimizer_ga, -(-2.062611870822739 + 1e-4), result);
+	}});
+
+	return benchmarks;
+}
+
+/**
+ * run a benchmark in a child process, result is sent back through a pipe
+ * and peak RSS is taken from resource usage of child
+ */
+bench_result runInChild(const benchmark & _benchmark)
+{
+	bench_result result;
+	int pipe_fds[2];
+	if(pipe(pipe_fds) != 0)
+	{
+		cerr<<"error creating pipe for benchmark : "<<_benchmark.name<<endl;
+		return result;
+	}
+
+	const pid_t pid = fork();
+	if(pid < 0)
+	{
+		cerr<<"error creating process for benchmark : "<<_benchmark.name<<endl;
+		close(pipe_fds[0]);
+		close(pipe_fds[1]);
+		return result;
+	}
+
+	if(pid == 0)
+	{
+		close(pipe_fds[0]);
+		_benchmark.run(result);
+		result.completed = true;
+		const bool written = write(pipe_fds[1], &result, sizeof(result)) == sizeof(result);
+		close(pipe_fds[1]);
+		_exit(written ? 0 : 1);
+	}
+
+	close(pipe_fds[1]);
+	const bool received = read(pipe_fds[0], &result, sizeof(result)) == sizeof(result);
+	close(pipe_fds[0]);
+
+	int status = 0;
+	struct rusage usage;
+	if(wait4(pid, &status, 0, &usage) != pid || !received
+			|| !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+	{
+		cerr<<"error running benchmark : "<<_benchmark.name<<endl;
+		result.completed = false;
+		return result;
+	}
+
+	// kilobytes on Linux
+	result.peak_rss_kb = usage.ru_maxrss;
+	return result;
+}
+
+void writeResults(ostream & out, const vector<benchmark> & benchmarks,
+		const vector<bench_result> & results, const bench_tolerances * tolerancesP)
+{
+	out<<setprecision(12)<<"{"<<endl;
+	if(tolerancesP != NULL)
+	{
+		out<<"  \"tolerances\": {\"wall_time\": "<<tolerancesP->wall_time
+				<<", \"wall_time_slack_seconds\": "<<tolerancesP->wall_time_slack_seconds
+				<<", \"evaluations\": "<<tolerancesP->evaluations
+				<<", \"generations\": "<<tolerancesP->generations
+				<<", \"peak_rss\": "<<tolerancesP->peak_rss
+				<<", \"peak_rss_slack_kb\": "<<tolerancesP->peak_rss_slack_kb
+				<<", \"fitness\": "<<tolerancesP->fitness<<"},"<<endl;
+	}
+
+	out<<"  \"benchmarks\": [";
+	for(size_t b = 0; b < benchmarks.size(); b++)
+	{
+		const bench_result & result = results[b];
+		out<<(b > 0 ? "," : "")<<endl<<"    {\"name\": \""<<benchmarks[b].name<<"\""
+				<<", \"completed\": "<<(result.completed ? "true" : "false")
+				<<", \"wall_seconds\": "<<result.wall_seconds
+				<<", \"evaluations\": "<<result.num_of_evaluations
+				<<", \"generations\": "<<result.num_of_generations
+				<<", \"generations_to_target\": ";
+		if(result.generations_to_target >= 0)
+		{
+			out<<result.generations_to_target;
+		}
+		else
+		{
+			out<<"null";
+		}
+		out<<", \"peak_rss_kb\": "<<result.peak_rss_kb
+				<<", \"final_fitness\": "<<result.final_fitness<<"}";
+	}
+	out<<endl<<"  ]"<<endl<<"}"<<endl;
+}
+
+/**
+ * check a value that should not be more than baseline (with relative tolerance
+ * and absolute slack), returns false and displays it if it has regressed
+ */
+bool checkNotMore(const string & name, const char * metric, double value,
+		double baseline_value, double tolerance, double slack)
+{
+	const double limit = baseline_value*(1 + tolerance) + slack;
+	if(value > limit)
+	{
+		cout<<"REGRESSION "<<name<<" "<<metric<<" : "<<value
+				<<" (baseline "<<baseline_value<<", limit "<<limit<<")"<<endl;
+		return false;
+	}
+	return true;
+}
+
+/**
+ * compare results with baseline, returns false if any of them has regressed
+ */
+bool compareWithBaseline(const json_value & baseline, const vector<benchmark> & benchmarks,
+		const vector<bench_result> & results)
+{
+	bench_tolerances tolerances;
+	const json_value & baseline_tolerances = baseline["tolerances"];
+	tolerances.wall_time = baseline_tolerances["wall_time"].getNumber(tolerances.wall_time);
+	tolerances.wall_time_slack_seconds = baseline_tolerances["wall_time_slack_seconds"]
+		.getNumber(tolerances.wall_time_slack_seconds);
+	tolerances.evaluations = baseline_tolerances["evaluations"].getNumber(tolerances.evaluations);
+	tolerances.generations = baseline_tolerances["generations"].getNumber(tolerances.generations);
+	tolerances.peak_rss = baseline_tolerances["peak_rss"].getNumber(tolerances.peak_rss);
+	tolerances.peak_rss_slack_kb = baseline_tolerances["peak_rss_slack_kb"]
+		.getNumber(tolerances.peak_rss_slack_kb);
+	tolerances.fitness = baseline_tolerances["fitness"].getNumber(tolerances.fitness);
+
+	bool passed = true;
+	for(size_t b = 0; b < benchmarks.size(); b++)
+	{
+		const string & name = benchmarks[b].name;
+		const bench_result & result = results[b];
+
+		const json_value * baseline_resultP = NULL;
+		for(const json_value & baseline_result : baseline["benchmarks"].array_values)
+		{
+			if(baseline_result["name"].string_value == name)
+			{
+				baseline_resultP = &baseline_result;
+			}
+		}
+		if(baseline_resultP == NULL)
+		{
+			cout<<"no baseline for "<<name<<" (not compared)"<<endl;
+			continue;
+		}
+		const json_value & baseline_result = *baseline_resultP;
+
+		if(!result.completed)
+		{
+			cout<<"REGRESSION "<<name<<" did not complete"<<endl;
+			passed = false;
+			continue;
+		}
+
+		bool benchmark_passed = true;
+		benchmark_passed &= checkNotMore(name, "wall_seconds", result.wall_seconds,
+				baseline_result["wall_seconds"].getNumber(), tolerances.wall_time,
+				tolerances.wall_time_slack_seconds);
+		benchmark_passed &= checkNotMore(name, "evaluations", result.num_of_evaluations,
+				baseline_result["evaluations"].getNumber(), tolerances.evaluations, 0);
+		benchmark_passed &= checkNotMore(name, "peak_rss_kb", result.peak_rss_kb,
+				baseline_result["peak_rss_kb"].getNumber(), tolerances.peak_rss,
+				tolerances.peak_rss_slack_kb);
+
+		const json_value & baseline_generations = baseline_result["generations_to_target"];
+		if(!baseline_generations.isNull())
+		{
+			if(result.generations_to_target < 0)
+			{
+				cout<<"REGRESSION "<<name<<" did not reach target (baseline reached it in "
+						<<baseline_generations.getNumber()<<" generations)"<<endl;
+				benchmark_passed = false;
+			}
+			else
+			{
+				benchmark_passed &= checkNotMore(name, "generations_to_target",
+						result.generations_to_target, baseline_generations.getNumber(),
+						tolerances.generations, 0);
+			}
+		}
+
+		const double baseline_fitness = baseline_result["final_fitness"].getNumber();
+		if(result.final_fitness < baseline_fitness - tolerances.fitness)
+		{
+			cout<<"REGRESSION "<<name<<" final_fitness : "<<result.final_fitness
+					<<" (baseline "<<baseline_fitness<<")"<<endl;
+			benchmark_passed = false;
+		}
+
+		cout<<(benchmark_passed ? "ok         " : "FAILED     ")<<name<<endl;
+		passed &= benchmark_passed;
+	}
+	return passed;
+}
+
+int main(int argc, char * argv[])
+{
+	string baseline_file, output_file, new_baseline_file, filter;
+	for(int i = 1; i < argc; i++)
+	{
+		const string option = argv[i];
+		if(i + 1 < argc && option == "--baseline")
+		{
+			baseline_file = argv[++i];
+		}
+		else if(i + 1 < argc && option == "--output")
+		{
+			output_file = argv[++i];
+		}
+		else if(i + 1 < argc && option == "--write-baseline")
+		{
+			new_baseline_file = argv[++i];
+		}
+		else if(i + 1 < argc && option == "--filter")
+		{
+			filter = argv[++i];
+		}
+		else
+		{
+			cerr<<"error invalid option : "<<option<<endl
+					<<"usage : "<<argv[0]<<" [--baseline FILE] [--output FILE]"
+					<<" [--write-baseline FILE] [--filter TEXT]"<<endl;
+			return 2;
+		}
+	}
+
+	// read baseline first, so that a wrong file is known before running
+	json_value baseline;
+	if(!baseline_file.empty())
+	{
+		ifstream baseline_stream(baseline_file);
+		stringstream baseline_text;
+		baseline_text<<baseline_stream.rdbuf();
+		json_reader reader;
+		if(!baseline_stream || !reader.parse(baseline_text.str(), baseline))
+		{
+			cerr<<"error reading baseline : "<<baseline_file
+					<<" (at position "<<reader.getErrorPosition()<<")"<<endl;
+			return 2;
+		}
+	}
+
+	vector<benchmark> benchmarks;
+	for(const benchmark & _benchmark : getBenchmarks())
+	{
+		if(_benchmark.name.find(filter) != string::npos)
+		{
+			benchmarks.push_back(_benchmark);
+		}
+	}
+
+	vector<bench_result> results;
+	for(const benchmark & _benchmark : benchmarks)
+	{
+		cerr<<"running "<<_benchmark.name<<".."<<endl;
+		results.push_back(runInChild(_benchmark));
+	}
+
+	if(output_file.empty())
+	{
+		writeResults(cout, benchmarks, results, NULL);
+	}
+	else
+	{
+		ofstream output_stream(output_file);
+		writeResults(output_stream, benchmarks, results, NULL);
+	}
+
+	if(!new_baseline_file.empty())
+	{
+		const bench_tolerances default_tolerances;
+		ofstream baseline_stream(new_baseline_file);
+		writeResults(baseline_stream, benchmarks, results, &default_tolerances);
+	}
+
+	if(!baseline_file.empty() && !compareWithBaseline(baseline, benchmarks, results))
+	{
+		cout<<"benchmarks regressed compared to baseline : "<<baseline_file<<endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,274 @@
+/*
+ * nqueen_kernel_bench.cpp
+ * Throughput of N-Queen fitness : one individual at a time and batched kernels
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <functional>
+#include <chrono>
+#include "nqueen_ga.h"
+
+using namespace std;
+
+/**
+ * N-QUEEN KERNEL BENCHMARK (nqueen_kernel_bench)
+ * ==============================================
+ * For N = 32, 100 and 1000 it scores the same random individuals (permutations) by
+ * checking all pairs of queens (reference), with getFitness, with line counts of one
+ * individual at a time (with and without conflicts of each position, as used for
+ * mutation) and with batched conflict kernel for each instruction set this CPU supports
+ * (scalar, AVX2, AVX-512), with and without conflicts of each position. Throughput is
+ * reported in individuals per second, and speedup is relative to pairwise counting.
+ *
+ * All kernels and getFitness must give the same counts as pairwise counting, and
+ * conflicts of positions must be non-zero exactly at positions of conflicting pairs,
+ * otherwise the program fails (exit code 1).
+ *
+ * USAGE
+ * nqueen_kernel_bench [--seconds S]
+ *   --seconds S   minimum time of each measurement (default : 0.5)
+ *
+ */
+
+/**
+ * individuals per second of score(), which scores num_of_indivs individuals
+ * (repeated until min_seconds have passed)
+ */
+double measureThroughput(size_t num_of_indivs, double min_seconds, const function<void()> & score)
+{
+	size_t num_of_scored = 0;
+	const chrono::steady_clock::time_point start_time = chrono::steady_clock::now();
+	double elapsed_seconds = 0;
+	do
+	{
+		score();
+		num_of_scored += num_of_indivs;
+		elapsed_seconds = chrono::duration<double>(chrono::steady_clock::now() - start_time).count();
+	} while(elapsed_seconds < min_seconds);
+	return num_of_scored/elapsed_seconds;
+}
+
+/**
+ * conflicting pairs of an individual, checked pair by pair
+ */
+int32_t countConflictsPairwise(const vector<int> & indiv)
+{
+	const int n = indiv.size();
+	int32_t conflicts = 0;
+	for(int i = 1; i < n; i++)
+	{
+		for(int j = 0; j < i; j++)
+		{
+			const int difference = abs(indiv[i] - indiv[j]);
+			conflicts += difference == 0 || difference == i - j;
+		}
+	}
+	return conflicts;
+}
+
+/**
+ * true if conflicts of positions are non-zero exactly at positions that are in
+ * a conflicting pair (checked pair by pair), and add up to twice the conflicts
+ */
+bool isPositionMaskCorrect(const vector<int> & indiv, const int32_t * position_conflicts,
+		size_t stride, int32_t conflicts)
+{
+	const int n = indiv.size();
+	vector<char> is_conflicting(n, false);
+	for(int i = 1; i < n; i++)
+	{
+		for(int j = 0; j < i; j++)
+		{
+			const int difference = abs(indiv[i] - indiv[j]);
+			if(difference == 0 || difference == i - j)
+			{
+				is_conflicting[i] = is_conflicting[j] = true;
+			}
+		}
+	}
+
+	int32_t sum_of_position_conflicts = 0;
+	for(int column = 0; column < n; column++)
+	{
+		const int32_t position_conflict = position_conflicts[column*stride];
+		if((position_conflict != 0) != (bool) is_conflicting[column])
+		{
+			return false;
+		}
+		sum_of_position_conflicts += position_conflict;
+	}
+	return sum_of_position_conflicts == 2*conflicts;
+}
+
+int main(int argc, char * argv[])
+{
+	double min_seconds = 0.5;
+	for(int a = 1; a < argc; a++)
+	{
+		const string arg = argv[a];
+		if(arg == "--seconds" && a + 1 < argc)
+		{
+			min_seconds = atof(argv[++a]);
+		}
+		else
+		{
+			cerr<<"error unknown argument : "<<arg<<endl
+					<<"usage : nqueen_kernel_bench [--seconds S]"<<endl;
+			return 2;
+		}
+	}
+
+	const nqueen_kernel_isa best_isa = detectNqueenKernelIsa();
+	vector<nqueen_kernel_isa> isas;
+	for(nqueen_kernel_isa isa : {NQUEEN_KERNEL_SCALAR, NQUEEN_KERNEL_AVX2, NQUEEN_KERNEL_AVX512})
+	{
+		if(isa <= best_isa)
+		{
+			isas.push_back(isa);
+		}
+	}
+
+	bool is_correct = true;
+	cout<<left<<setw(8)<<"N"<<setw(28)<<"kernel"<<right<<setw(16)<<"indivs/s"
+			<<setw(10)<<"speedup"<<endl;
+	for(int n : {32, 100, 1000})
+	{
+		const size_t num_of_indivs = n < 1000 ? 4096 : 256;
+		xoshiro256ss random_engine(n);
+		vector<vector<int>> indivs(num_of_indivs);
+		vector<const vector<int> *> indiv_pointers;
+		for(vector<int> & indiv : indivs)
+		{
+			fillRandomPermutation(indiv, n, random_engine);
+			indiv_pointers.push_back(&indiv);
+		}
+
+		// reference : all pairs of one individual at a time
+		vector<double> expected_fitness(num_of_indivs);
+		const double pairwise_throughput = measureThroughput(num_of_indivs, min_seconds, [&]()
+		{
+			for(size_t i = 0; i < num_of_indivs; i++)
+			{
+				expected_fitness[i] = - countConflictsPairwise(indivs[i]);
+			}
+		});
+		cout<<left<<setw(8)<<n<<setw(28)<<"pairwise"<<right<<setw(16)<<fixed
+				<<setprecision(0)<<pairwise_throughput<<setw(10)<<setprecision(2)<<1.0<<endl;
+
+		nqueen_fitness fitness_function(n);
+		vector<double> indiv_fitness(num_of_indivs);
+		const double fitness_throughput = measureThroughput(num_of_indivs, min_seconds, [&]()
+		{
+			for(size_t i = 0; i < num_of_indivs; i++)
+			{
+				indiv_fitness[i] = fitness_function(indivs[i]);
+			}
+		});
+		if(indiv_fitness != expected_fitness)
+		{
+			cerr<<"error getFitness differs from pairwise counting (N = "<<n<<")"<<endl;
+			is_correct = false;
+		}
+		cout<<left<<setw(8)<<n<<setw(28)<<"getFitness"<<right<<setw(16)
+				<<setprecision(0)<<fitness_throughput<<setw(10)<<setprecision(2)
+				<<fitness_throughput/pairwise_throughput<<endl;
+
+		// line counts of one individual at a time, with conflicts of positions as in mutation
+		vector<int32_t> line_counts(nqueenLineCountsSize(n), 0);
+		vector<int32_t> single_position_conflicts(n);
+		vector<int32_t> single_conflicts(num_of_indivs);
+		for(bool with_positions : {false, true})
+		{
+			const double throughput = measureThroughput(num_of_indivs, min_seconds, [&]()
+			{
+				for(size_t i = 0; i < num_of_indivs; i++)
+				{
+					single_conflicts[i] = countNqueenIndivConflicts(indivs[i].data(), n,
+							line_counts.data(), with_positions ? single_position_conflicts.data()
+							: NULL);
+				}
+			});
+			for(size_t i = 0; i < num_of_indivs; i++)
+			{
+				if(- single_conflicts[i] != expected_fitness[i])
+				{
+					cerr<<"error single individual kernel gives "<<- single_conflicts[i]
+							<<" for individual "<<i<<" (N = "<<n<<"), pairwise counting gives "
+							<<expected_fitness[i]<<endl;
+					is_correct = false;
+					break;
+				}
+			}
+			if(with_positions && !isPositionMaskCorrect(indivs.back(),
+					single_position_conflicts.data(), 1, single_conflicts.back()))
+			{
+				cerr<<"error single individual kernel gives wrong conflicts of positions (N = "
+						<<n<<")"<<endl;
+				is_correct = false;
+			}
+			cout<<left<<setw(8)<<n<<setw(28)<<(with_positions ? "single + positions" : "single")
+					<<right<<setw(16)<<setprecision(0)<<throughput<<setw(10)<<setprecision(2)
+					<<throughput/pairwise_throughput<<endl;
+		}
+
+		vector<int32_t> rows(n*NQUEEN_BATCH_WIDTH);
+		vector<int32_t> conflicts(num_of_indivs + NQUEEN_BATCH_WIDTH);
+		vector<int32_t> position_conflicts(n*NQUEEN_BATCH_WIDTH);
+		for(nqueen_kernel_isa isa : isas)
+		{
+			for(bool with_positions : {false, true})
+			{
+				const double throughput = measureThroughput(num_of_indivs, min_seconds, [&]()
+				{
+					for(size_t first = 0; first < num_of_indivs; first += NQUEEN_BATCH_WIDTH)
+					{
+						loadNqueenBatch(indiv_pointers.data() + first,
+								min(NQUEEN_BATCH_WIDTH, num_of_indivs - first), n, rows.data());
+						countNqueenConflicts(rows.data(), n, conflicts.data() + first,
+								with_positions ? position_conflicts.data() : NULL,
+								line_counts.data(), isa);
+					}
+				});
+
+				for(size_t i = 0; i < num_of_indivs; i++)
+				{
+					if(- conflicts[i] != expected_fitness[i])
+					{
+						cerr<<"error kernel "<<getNqueenKernelIsaName(isa)<<" gives "
+								<<- conflicts[i]<<" for individual "<<i<<" (N = "<<n
+								<<"), pairwise counting gives "<<expected_fitness[i]<<endl;
+						is_correct = false;
+						break;
+					}
+				}
+
+				// conflicts of positions of last batch must match its conflicting pairs
+				const size_t last_first = (num_of_indivs - 1)/NQUEEN_BATCH_WIDTH*NQUEEN_BATCH_WIDTH;
+				for(size_t i = last_first; with_positions && i < num_of_indivs; i++)
+				{
+					if(!isPositionMaskCorrect(indivs[i], position_conflicts.data() + (i - last_first),
+							NQUEEN_BATCH_WIDTH, conflicts[i]))
+					{
+						cerr<<"error kernel "<<getNqueenKernelIsaName(isa)
+								<<" gives wrong conflicts of positions (N = "<<n<<")"<<endl;
+						is_correct = false;
+						break;
+					}
+				}
+
+				const string kernel_name = string("batched ") + getNqueenKernelIsaName(isa)
+						+ (with_positions ? " + positions" : "");
+				cout<<left<<setw(8)<<n<<setw(28)<<kernel_name<<right<<setw(16)
+						<<setprecision(0)<<throughput<<setw(10)<<setprecision(2)
+						<<throughput/pairwise_throughput<<endl;
+			}
+		}
+	}
+
+	return is_correct ? 0 : 1;
+}
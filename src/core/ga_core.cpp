@@ -0,0 +1,43 @@
+/*
+ * ga_core.cpp
+ * Explicit instantiations of simple_ga and crossovers for common genome types
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#include "ga.h"
+#include "util/crossovers.h"
+
+using namespace std;
+
+/**
+ * GA CORE LIBRARY (ga_core)
+ * =========================
+ * Compiles simple_ga and crossovers of the types listed in ga.h and crossovers.h
+ * (PRE-INSTANTIATED GENETIC ALGORITHMS) once. Targets that link ga_core get
+ * GA_CORE_LIBRARY defined, so their translation units use these instantiations
+ * (extern template) and only compile their own derived classes.
+ *
+ * Both the default random engine (mt19937) and xoshiro256ss (used by the examples)
+ * are instantiated.
+ *
+ */
+
+namespace ga
+{
+template class simple_ga<vector<int>>;
+template class simple_ga<vector<int>, xoshiro256ss>;
+template class simple_ga<vector<double>>;
+template class simple_ga<vector<double>, xoshiro256ss>;
+template class simple_ga<vector<bool>>;
+template class simple_ga<vector<bool>, xoshiro256ss>;
+
+template vector<int> onePointCrossover(const vector<int> &, const vector<int> &);
+template vector<int> twoPointCrossover(const vector<int> &, const vector<int> &);
+template vector<double> onePointCrossover(const vector<double> &, const vector<double> &);
+template vector<double> twoPointCrossover(const vector<double> &, const vector<double> &);
+template vector<bool> onePointCrossover(const vector<bool> &, const vector<bool> &);
+template vector<bool> twoPointCrossover(const vector<bool> &, const vector<bool> &);
+}
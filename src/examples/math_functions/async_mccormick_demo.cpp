@@ -0,0 +1,59 @@
+/*
+ * async_mccormick_demo.cpp
+ * A demo for minimizing McCormick function with slow and
+ * uneven fitness evaluations (asynchronous evaluation)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#define _USE_MATH_DEFINES
+
+#include "function_minimizer_ga.h"
+
+using namespace std;
+
+/**
+ * Asynchronous McCormick Function DEMO
+ * ====================================
+ * A demo run for minimizing McCormick function (x is in [-1.5, 4] and y is in [-3, 4]),
+ * when each function call takes between 1 ms and 40 ms (like a simulator).
+ * Fitness is calculated by 4 threads without waiting for whole generations,
+ * and a call taking more than 35 ms gets a penalty.
+ *
+ */
+
+
+/**
+ * McCormick Function with a random delay
+ *      f(x, y) = sin(x + y) + (x - y)^2 - 1.5*x + 2.5*y + 1;
+ */
+double slow_mccormick_func(double x, double y)
+{
+	// each evaluation thread has its own random engine
+	static thread_local mt19937 random_engine_delay(
+			hash<thread::id>()(this_thread::get_id()));
+	uniform_int_distribution<int> distrib_delay(1, 40);
+	this_thread::sleep_for(chrono::milliseconds(distrib_delay(random_engine_delay)));
+
+	return sin(x + y) + pow(x - y, 2) - 1.5*x + 2.5*y + 1;
+}
+
+
+int main()
+{
+	// set precision for display to 15 decimal places
+	cout.precision(15);
+
+	function_minimizer_ga _function_minimizer_ga(&slow_mccormick_func, -1.5, -3, 4, 4);
+	_function_minimizer_ga.setParameters(40, 40, 0.9, 0.1, -1, true);
+	_function_minimizer_ga.setAsyncEvaluation(4);
+	// penalty is the worst value of function in its range (negative for fitness)
+	_function_minimizer_ga.setEvaluationDeadline(35, -50);
+	_function_minimizer_ga.run();
+	_function_minimizer_ga.displaySettings();
+	_function_minimizer_ga.displayResults();
+
+	return 0;
+}
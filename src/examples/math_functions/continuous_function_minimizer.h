@@ -0,0 +1,77 @@
+/*
+ * continuous_function_minimizer.h
+ * Differential Evolution and CMA-ES for minimizing any given mathematical function
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef CONTINUOUS_FUNCTION_MINIMIZER_H_
+#define CONTINUOUS_FUNCTION_MINIMIZER_H_
+
+#include "differential_evolution.h"
+#include "cma_es.h"
+
+using namespace std;
+using namespace ga;
+
+/**
+ * FUNCTION MINIMIZER WITH A CONTINUOUS OPTIMIZER (continuous_function_minimizer)
+ * ==============================================================================
+ * Same function and bounds as function_minimizer_ga (function with two variables),
+ * minimized with Differential Evolution or CMA-ES (type parameter Optimizer).
+ *
+ * FITNESS FUNCTION - Negative of the given function
+ *
+ */
+template<typename Optimizer>
+class continuous_function_minimizer : public Optimizer
+{
+public :
+
+	/**
+	 * use this constructor when min and max values are same for both variables
+	 */
+	continuous_function_minimizer(double(* a_function) (double x, double y),
+			double min_values, double max_values) :
+		Optimizer({min_values, min_values}, {max_values, max_values}),
+		func_to_minimize(a_function)
+	{
+	}
+
+	/**
+	 * for explicitly setting the min and max values of both the variables
+	 */
+	continuous_function_minimizer(double (*a_function)(double x, double y),
+			double min_value_x, double min_value_y, double max_value_x, double max_value_y) :
+		Optimizer({min_value_x, min_value_y}, {max_value_x, max_value_y}),
+		func_to_minimize(a_function)
+	{
+	}
+
+protected:
+
+	/**
+	 * a pointer to the function to be minimized
+	 */
+	double (* func_to_minimize)(double x, double y) = NULL;
+
+	/**
+	 * negative of the given function
+	 */
+	double getFitness(const vector<double> & variables) override
+	{
+		return -1*(*func_to_minimize)(variables[0], variables[1]);
+	}
+
+	void displaySolution(const vector<double> & variables) override
+	{
+		cout<<"x = " << variables[0]<<", ";
+		cout<<"y = " << variables[1]<<endl;
+	}
+};
+
+typedef continuous_function_minimizer<differential_evolution<xoshiro256ss>> function_minimizer_de;
+typedef continuous_function_minimizer<cma_es<xoshiro256ss>> function_minimizer_cma_es;
+
+#endif /* CONTINUOUS_FUNCTION_MINIMIZER_H_ */
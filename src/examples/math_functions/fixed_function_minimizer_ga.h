@@ -0,0 +1,254 @@
+/*
+ * fixed_function_minimizer_ga.h
+ * Genetic Algorithm for minimizing a function of a fixed number of variables
+ * (std::array individuals)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef FIXED_FUNCTION_MINIMIZER_GA_H_
+#define FIXED_FUNCTION_MINIMIZER_GA_H_
+
+#include <array>
+#include "ga.h"
+
+using namespace std;
+using namespace ga;
+
+/**
+ * GENETIC ALGORITHM FOR MINIMIZING A FUNCTION OF NUM_OF_VARIABLES VARIABLES
+ * (fixed_function_minimizer_ga)
+ * =========================================================================
+ * Same operators as function_minimizer_ga, for any number of variables known at compile
+ * time. An individual is an array<double, NUM_OF_VARIABLES>, so individuals of a generation
+ * are one block of memory and loops over variables have compile time bounds.
+ *
+ * FITNESS FUNCTION - Negative of the given function
+ *
+ * CROSSOVER OPERATOR - randomly weighted average of two parents
+ *
+ * MUTATION OPERATOR - increment/decrement a randomly selected variable by a random value
+ *                     (in [-10% of range of variable, +10% of range of variable], or in
+ *                     +- mutation step size of the individual with self-adaptive mutation)
+ *
+ * Operators only use given random engines, so it also runs in large population mode.
+ *
+ */
+template<size_t NUM_OF_VARIABLES>
+class fixed_function_minimizer_ga : public simple_ga<array<double, NUM_OF_VARIABLES>, xoshiro256ss>
+{
+	static_assert(NUM_OF_VARIABLES > 0, "function must have at least one variable");
+
+public :
+	typedef array<double, NUM_OF_VARIABLES> indiv_type;
+	typedef simple_ga<indiv_type, xoshiro256ss> base_ga;
+	typedef typename base_ga::random_engine_type random_engine_type;
+	typedef typename base_ga::crossoverParents crossoverParents;
+
+	/**
+	 * use this constructor when min and max values are same for all variables
+	 */
+	fixed_function_minimizer_ga(double (* a_function)(const indiv_type & variables),
+			double min_values, double max_values)
+	{
+		indiv_type min_value_of_variables;
+		indiv_type max_value_of_variables;
+		min_value_of_variables.fill(min_values);
+		max_value_of_variables.fill(max_values);
+		func_to_minimize = a_function;
+		initMinMax(min_value_of_variables, max_value_of_variables);
+		initRandomEngines();
+	}
+
+	/**
+	 * for explicitly setting the min and max values of each variable
+	 */
+	fixed_function_minimizer_ga(double (* a_function)(const indiv_type & variables),
+			const indiv_type & min_values, const indiv_type & max_values)
+	{
+		func_to_minimize = a_function;
+		initMinMax(min_values, max_values);
+		initRandomEngines();
+	}
+
+protected:
+	/**
+	 * a pointer to the function to be minimized
+	 */
+	double (* func_to_minimize)(const indiv_type & variables) = NULL;
+
+	indiv_type getRandomIndiv() override;
+	bool generateRandomIndiv(indiv_type & indiv, random_engine_type & random_engine) override;
+	void initRandomEngines() override;
+	double getFitness(const indiv_type & indiv) override;
+	void displayIndiv(const indiv_type & indiv) override;
+	indiv_type crossOver(const crossoverParents & crossover_parents) override;
+	bool crossOverWithEngine(const crossoverParents & crossover_parents,
+			indiv_type & offspring, random_engine_type & random_engine) override;
+	void mutate(indiv_type & indiv) override;
+	bool mutateWithEngine(indiv_type & indiv, random_engine_type & random_engine) override;
+
+private:
+	// minimum value of each variable
+	indiv_type VAR_MIN_VALUES;
+	// maximum value of each variable
+	indiv_type VAR_MAX_VALUES;
+
+	// random individual generation engine
+	random_engine_type random_engine_init;
+	// random engine for weight of parent1
+	random_engine_type random_engine_crossover;
+	// random engine for variable selection and its increment
+	random_engine_type random_engine_mutation;
+
+	void initMinMax(const indiv_type & min_values, const indiv_type & max_values);
+	void weightedAverageCrossover(const crossoverParents & crossover_parents,
+			indiv_type & offspring, random_engine_type & random_engine);
+	void incrementMutation(indiv_type & indiv, random_engine_type & random_engine);
+};
+
+
+/**
+ * IMPLEMENTATION OF METHODS OF CLASS
+ * ==================================
+ */
+
+/**
+ * swap min and max values of a variable if min value is greater than max value
+ */
+template<size_t NUM_OF_VARIABLES>
+void fixed_function_minimizer_ga<NUM_OF_VARIABLES>::initMinMax(const indiv_type & min_values,
+		const indiv_type & max_values)
+{
+	for(size_t v = 0; v < NUM_OF_VARIABLES; v++)
+	{
+		if(min_values[v] > max_values[v])
+		{
+			cerr<<"error min value of variable "<<v<<" : "<<min_values[v]
+					<<" is greater than its max value : "<<max_values[v]
+					<<". swapping min and max values"<<endl;
+		}
+		VAR_MIN_VALUES[v] = min(min_values[v], max_values[v]);
+		VAR_MAX_VALUES[v] = max(min_values[v], max_values[v]);
+	}
+}
+
+template<size_t NUM_OF_VARIABLES>
+typename fixed_function_minimizer_ga<NUM_OF_VARIABLES>::indiv_type
+fixed_function_minimizer_ga<NUM_OF_VARIABLES>::getRandomIndiv()
+{
+	indiv_type indiv;
+	generateRandomIndiv(indiv, random_engine_init);
+	return indiv;
+}
+
+/**
+ * a random value for each variable between its min and max value
+ */
+template<size_t NUM_OF_VARIABLES>
+bool fixed_function_minimizer_ga<NUM_OF_VARIABLES>::generateRandomIndiv(indiv_type & indiv,
+		random_engine_type & random_engine)
+{
+	uniform_real_distribution<double> uniform_distribution_0_and_1(0, 1);
+	for(size_t v = 0; v < NUM_OF_VARIABLES; v++)
+	{
+		indiv[v] = VAR_MIN_VALUES[v] + uniform_distribution_0_and_1(random_engine)
+				*(VAR_MAX_VALUES[v] - VAR_MIN_VALUES[v]);
+	}
+	return true;
+}
+
+template<size_t NUM_OF_VARIABLES>
+void fixed_function_minimizer_ga<NUM_OF_VARIABLES>::initRandomEngines()
+{
+	random_engine_init = this->nextRandomStream();
+	random_engine_crossover = this->nextRandomStream();
+	random_engine_mutation = this->nextRandomStream();
+}
+
+/**
+ * negative of the given function
+ */
+template<size_t NUM_OF_VARIABLES>
+double fixed_function_minimizer_ga<NUM_OF_VARIABLES>::getFitness(const indiv_type & indiv)
+{
+	return -1*(*func_to_minimize)(indiv);
+}
+
+template<size_t NUM_OF_VARIABLES>
+void fixed_function_minimizer_ga<NUM_OF_VARIABLES>::displayIndiv(const indiv_type & indiv)
+{
+	for(size_t v = 0; v < NUM_OF_VARIABLES; v++)
+	{
+		cout<<"x"<<v<<" = "<<indiv[v]<<(v + 1 < NUM_OF_VARIABLES ? ", " : "");
+	}
+	cout<<endl;
+}
+
+template<size_t NUM_OF_VARIABLES>
+typename fixed_function_minimizer_ga<NUM_OF_VARIABLES>::indiv_type
+fixed_function_minimizer_ga<NUM_OF_VARIABLES>::crossOver(const crossoverParents & crossover_parents)
+{
+	indiv_type offspring;
+	weightedAverageCrossover(crossover_parents, offspring, random_engine_crossover);
+	return offspring;
+}
+
+template<size_t NUM_OF_VARIABLES>
+bool fixed_function_minimizer_ga<NUM_OF_VARIABLES>::crossOverWithEngine(
+		const crossoverParents & crossover_parents, indiv_type & offspring,
+		random_engine_type & random_engine)
+{
+	weightedAverageCrossover(crossover_parents, offspring, random_engine);
+	return true;
+}
+
+/**
+ * weighted average of values of first and second parent
+ * (weight is a random value uniformly distributed between 0 and 1)
+ */
+template<size_t NUM_OF_VARIABLES>
+void fixed_function_minimizer_ga<NUM_OF_VARIABLES>::weightedAverageCrossover(
+		const crossoverParents & crossover_parents, indiv_type & offspring,
+		random_engine_type & random_engine)
+{
+	const double weight_parent1 = uniform_real_distribution<double>(0, 1)(random_engine);
+	const indiv_type & parent1 = *crossover_parents.parent1;
+	const indiv_type & parent2 = *crossover_parents.parent2;
+	for(size_t v = 0; v < NUM_OF_VARIABLES; v++)
+	{
+		offspring[v] = weight_parent1*parent1[v] + (1 - weight_parent1)*parent2[v];
+	}
+}
+
+template<size_t NUM_OF_VARIABLES>
+void fixed_function_minimizer_ga<NUM_OF_VARIABLES>::mutate(indiv_type & indiv)
+{
+	incrementMutation(indiv, random_engine_mutation);
+}
+
+template<size_t NUM_OF_VARIABLES>
+bool fixed_function_minimizer_ga<NUM_OF_VARIABLES>::mutateWithEngine(indiv_type & indiv,
+		random_engine_type & random_engine)
+{
+	incrementMutation(indiv, random_engine);
+	return true;
+}
+
+/**
+ * with equal probability select a variable, increment it by a random value
+ * in [-step of its range, +step of its range] and keep it within bounds
+ * (step is mutation step size, 10% by default or of individual with self-adaptive mutation)
+ */
+template<size_t NUM_OF_VARIABLES>
+void fixed_function_minimizer_ga<NUM_OF_VARIABLES>::incrementMutation(indiv_type & indiv,
+		random_engine_type & random_engine)
+{
+	const size_t v = uniform_int_distribution<size_t>(0, NUM_OF_VARIABLES - 1)(random_engine);
+	const double increment_size = this->getMutationStepSize()*(VAR_MAX_VALUES[v] - VAR_MIN_VALUES[v]);
+	indiv[v] += uniform_real_distribution<double>(-increment_size, increment_size)(random_engine);
+	indiv[v] = min(max(indiv[v], VAR_MIN_VALUES[v]), VAR_MAX_VALUES[v]);
+}
+
+#endif /* FIXED_FUNCTION_MINIMIZER_GA_H_ */
@@ -10,6 +10,8 @@
 using namespace std;
 using namespace ga;
 
+template class ga::simple_ga<function_variables, xoshiro256ss>;
+
 /**
  * IMPLEMENTATION OF FUNCTION MINIMIZER GA (function_minimizer_ga)
  * ==============================================================
@@ -20,7 +22,10 @@ using namespace ga;
  *                     (a random point, between the two points, on the line joining them)
  *
  * MUTATION OPERATOR - increment/decrement a random value
- *                     (random value lies in [-10% of range of variable, +10% of range of variable])
+ *                     (random value lies in [-10% of range of variable, +10% of range of variable],
+ *                     or in +- mutation step size of the individual with self-adaptive mutation)
+ *
+ * LOCAL SEARCH - Nelder-Mead simplex (for memetic mode, see setLocalSearch)
  *
  */
 
@@ -79,21 +84,157 @@ void function_minimizer_ga::displayIndiv(const function_variables & indiv)
 void function_minimizer_ga::mutate(function_variables &indiv)
 {
 	float select_mutation_var = _uniform_distribution_0_and_1(random_engine_var_selection);
+	// increments are scaled from 10% of range to step size (of individual)
+	const double step_scale = getMutationStepSize()/MUTATION_RANGE_FRACTION;
 
 	// with 1/2 probability select x
 	if(select_mutation_var <= 0.5)
 	{
-		indiv.x += _uniform_distribution_increment_x(random_engine_increment_x);
+		indiv.x += step_scale*_uniform_distribution_increment_x(random_engine_increment_x);
 		boundX(indiv);
 	}
 	// with remaining 1/2 probability select y
 	else
 	{
-		indiv.y += _uniform_distribution_increment_y(random_engine_increment_y);
+		indiv.y += step_scale*_uniform_distribution_increment_y(random_engine_increment_y);
 		boundY(indiv);
 	}
 }
 
+/**
+ * NELDER-MEAD LOCAL SEARCH
+ * ========================
+ * A simplex (triangle) of individual and two points at 1% of range of x and y from
+ * it is moved downhill by reflection, expansion, contraction and shrink
+ * (coefficients 1, 2, 0.5, 0.5) until budget of fitness evaluations is used.
+ * Points are kept within bounds. Individual is set to best vertex of simplex.
+ */
+double function_minimizer_ga::localSearch(function_variables & indiv, double fitness,
+		unsigned budget)
+{
+	const int NUM_OF_VERTICES = 3;
+	function_variables vertices[NUM_OF_VERTICES] = { indiv, indiv, indiv };
+	// vertices that budget does not allow to evaluate are never selected
+	double vertex_fitness[NUM_OF_VERTICES] = { fitness, - DBL_MAX, - DBL_MAX };
+	// step away from a bound so that simplex is not flat
+	vertices[1].x += indiv.x + LOCAL_SEARCH_STEP.x <= VAR_MAX_VALUES.x ?
+			LOCAL_SEARCH_STEP.x : -LOCAL_SEARCH_STEP.x;
+	vertices[2].y += indiv.y + LOCAL_SEARCH_STEP.y <= VAR_MAX_VALUES.y ?
+			LOCAL_SEARCH_STEP.y : -LOCAL_SEARCH_STEP.y;
+
+	unsigned num_of_evaluations = 0;
+	// evaluate a point within bounds
+	auto evaluate = [&](function_variables & point)
+	{
+		boundX(point);
+		boundY(point);
+		num_of_evaluations++;
+		return getFitness(point);
+	};
+	// a point on the line from centroid through worst vertex
+	auto pointAt = [&](const function_variables & centroid, double coefficient)
+	{
+		function_variables point;
+		point.x = centroid.x + coefficient*(centroid.x - vertices[2].x);
+		point.y = centroid.y + coefficient*(centroid.y - vertices[2].y);
+		return point;
+	};
+
+	// given fitness is fitness of this individual only with Lamarckian write-back
+	// (with Baldwinian write-back it can be an improved fitness of an earlier search)
+	for(int v = LAMARCKIAN ? 1 : 0; v < NUM_OF_VERTICES && num_of_evaluations < budget; v++)
+	{
+		vertex_fitness[v] = evaluate(vertices[v]);
+	}
+	const double start_fitness = vertex_fitness[0];
+
+	while(num_of_evaluations + 1 < budget)
+	{
+		// order vertices from best to worst (fitness is maximized)
+		for(int i = 1; i < NUM_OF_VERTICES; i++)
+		{
+			for(int j = i; j > 0 && vertex_fitness[j] > vertex_fitness[j - 1]; j--)
+			{
+				swap(vertices[j], vertices[j - 1]);
+				swap(vertex_fitness[j], vertex_fitness[j - 1]);
+			}
+		}
+
+		function_variables centroid;
+		centroid.x = (vertices[0].x + vertices[1].x)/2;
+		centroid.y = (vertices[0].y + vertices[1].y)/2;
+
+		function_variables reflected = pointAt(centroid, 1);
+		const double reflected_fitness = evaluate(reflected);
+		if(reflected_fitness > vertex_fitness[0])
+		{
+			function_variables expanded = pointAt(centroid, 2);
+			const double expanded_fitness = evaluate(expanded);
+			if(expanded_fitness > reflected_fitness)
+			{
+				vertices[2] = expanded;
+				vertex_fitness[2] = expanded_fitness;
+			}
+			else
+			{
+				vertices[2] = reflected;
+				vertex_fitness[2] = reflected_fitness;
+			}
+		}
+		else if(reflected_fitness > vertex_fitness[1])
+		{
+			vertices[2] = reflected;
+			vertex_fitness[2] = reflected_fitness;
+		}
+		else
+		{
+			// contract towards better of reflected and worst point
+			const bool outside = reflected_fitness > vertex_fitness[2];
+			function_variables contracted = pointAt(centroid, outside ? 0.5 : -0.5);
+			const double contracted_fitness = evaluate(contracted);
+			if(contracted_fitness > max(reflected_fitness, vertex_fitness[2]))
+			{
+				vertices[2] = contracted;
+				vertex_fitness[2] = contracted_fitness;
+			}
+			else
+			{
+				// shrink towards best vertex
+				for(int v = 1; v < NUM_OF_VERTICES && num_of_evaluations < budget; v++)
+				{
+					vertices[v].x = (vertices[0].x + vertices[v].x)/2;
+					vertices[v].y = (vertices[0].y + vertices[v].y)/2;
+					vertex_fitness[v] = evaluate(vertices[v]);
+				}
+			}
+		}
+	}
+
+	statistics.num_of_evaluations += num_of_evaluations;
+
+	const int best_vertex = max_element(vertex_fitness, vertex_fitness + NUM_OF_VERTICES)
+		- vertex_fitness;
+	if(vertex_fitness[best_vertex] > start_fitness)
+	{
+		indiv = vertices[best_vertex];
+		return vertex_fitness[best_vertex];
+	}
+	return start_fitness;
+}
+
+/**
+ * each random engine is an independent stream of GA's seed
+ */
+void function_minimizer_ga::initRandomEngines()
+{
+	random_engine_x = nextRandomStream();
+	random_engine_y = nextRandomStream();
+	random_engine_weight_parent1 = nextRandomStream();
+	random_engine_var_selection = nextRandomStream();
+	random_engine_increment_x = nextRandomStream();
+	random_engine_increment_y = nextRandomStream();
+}
+
 /**
  * reset x to be in [x min value, x max value]
  *
@@ -151,13 +292,17 @@ void function_minimizer_ga::init_min_max(double min_value_x, double min_value_y,
 	_uniform_distribution_y =
 			uniform_real_distribution<double> {min_value_y, max_value_y};
 
-	// multiplication factor 0.1 can be parameterized later
 	// step size for x is +- 10% of the total range of x
-	double x_increment_size = 0.1*abs(max_value_x - min_value_x);
+	// (scaled by mutation step size of simple GA in mutate)
+	double x_increment_size = MUTATION_RANGE_FRACTION*abs(max_value_x - min_value_x);
 	_uniform_distribution_increment_x =
 			uniform_real_distribution<double> {-x_increment_size, x_increment_size};
 	// step size for y is +- 10% of the total range of y
-	double y_increment_size = 0.1*abs(max_value_y - min_value_y);
+	double y_increment_size = MUTATION_RANGE_FRACTION*abs(max_value_y - min_value_y);
 	_uniform_distribution_increment_y =
 			uniform_real_distribution<double> {-y_increment_size, y_increment_size};
+
+	// first simplex of local search is 1% of the range of each variable
+	LOCAL_SEARCH_STEP.x = 0.01*abs(max_value_x - min_value_x);
+	LOCAL_SEARCH_STEP.y = 0.01*abs(max_value_y - min_value_y);
 }
@@ -30,7 +30,38 @@ struct function_variables
 	double y;
 };
 
-class function_minimizer_ga : public simple_ga<function_variables>
+namespace ga
+{
+/**
+ * Euclidean distance between variables (for diversity of population)
+ */
+template<>
+struct genome_traits<function_variables>
+{
+	static const bool is_supported = true;
+
+	static uint64_t hash(const function_variables & indiv)
+	{
+		return hashBytes(&indiv, sizeof(indiv));
+	}
+
+	static bool equal(const function_variables & indiv1, const function_variables & indiv2)
+	{
+		return indiv1.x == indiv2.x && indiv1.y == indiv2.y;
+	}
+
+	static double distance(const function_variables & indiv1,
+			const function_variables & indiv2)
+	{
+		return hypot(indiv1.x - indiv2.x, indiv1.y - indiv2.y);
+	}
+};
+
+// simple_ga of function variables is compiled once in function_minimizer library
+extern template class simple_ga<function_variables, xoshiro256ss>;
+}
+
+class function_minimizer_ga : public simple_ga<function_variables, xoshiro256ss>
 {
 public :
 
@@ -42,6 +73,7 @@ public :
 	{
 		func_to_minimize = a_function;
 		init_min_max(min_values, min_values, max_values, max_values);
+		initRandomEngines();
 	}
 
 	/**
@@ -52,6 +84,7 @@ public :
 	{
 		func_to_minimize = a_function;
 		init_min_max(min_value_x, min_value_y, max_value_x, max_value_y);
+		initRandomEngines();
 	}
 
 protected:
@@ -69,6 +102,8 @@ protected:
 	void displayIndiv(const function_variables & indiv) override;
 	function_variables crossOver(const crossoverParents & crossover_parents) override;
 	void mutate(function_variables &indiv) override;
+	double localSearch(function_variables & indiv, double fitness, unsigned budget) override;
+	void initRandomEngines() override;
 
 
 	void boundX(function_variables &indiv);
@@ -82,19 +117,19 @@ private:
 	function_variables VAR_MAX_VALUES;
 
 	// random engine for generating values of x
-	mt19937 random_engine_x;
+	random_engine_type random_engine_x;
 	// random engine for generating values of y
-	mt19937 random_engine_y;
+	random_engine_type random_engine_y;
 
 	// random engine for generating values of weight for parent1
-	mt19937 random_engine_weight_parent1;
+	random_engine_type random_engine_weight_parent1;
 
 	// random engine for making selection of variable for mutation
-	mt19937 random_engine_var_selection;
+	random_engine_type random_engine_var_selection;
 	// random engine for increment in x
-	mt19937 random_engine_increment_x;
+	random_engine_type random_engine_increment_x;
 	// random engine for increment in y
-	mt19937 random_engine_increment_y;
+	random_engine_type random_engine_increment_y;
 
 
 	// generate uniformly distributed values for various cases
@@ -120,6 +155,13 @@ private:
 	_uniform_distribution_increment_y;
 
 
+	// range of increment of mutation as a fraction of range of a variable
+	// (same as default mutation step size, which scales it)
+	const double MUTATION_RANGE_FRACTION = 0.1;
+
+	// size of first simplex of Nelder-Mead local search for x and y
+	function_variables LOCAL_SEARCH_STEP;
+
 	// for initialization of variables and distributions
 	// initialize values dependent on min and max values of variables
 	void init_min_max(double min_value_x, double min_value_y,
@@ -0,0 +1,117 @@
+/*
+ * mccormick_shm_demo.cpp
+ * A demo for minimizing McCormick function with fitness calculated by
+ * local worker processes over shared memory
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#define _USE_MATH_DEFINES
+
+#include <cstdlib>
+#include <sys/wait.h>
+#include "function_minimizer_ga.h"
+#include "eval/shm_evaluator.h"
+#include "eval/shm_worker.h"
+
+using namespace std;
+
+/**
+ * SHARED MEMORY McCormick Function DEMO
+ * =====================================
+ * usage : mccormick_shm_demo [number of workers]
+ *
+ * Starts worker processes (default 2), which calculate fitness of function_minimizer_ga
+ * (negative of McCormick function) from genome slots of a shared memory segment.
+ * GA is run with same parameters as McCormick demo, first with fitness calculated
+ * by GA itself and then by the workers, and both must find the same minimum.
+ *
+ */
+
+
+/**
+ * McCormick Function
+ *      f(x, y) = sin(x + y) + (x - y)^2 - 1.5*x + 2.5*y + 1;
+ */
+double mccormick_func(double x, double y)
+{
+	return sin(x + y) + pow((x - y), 2) - 1.5*x + 2.5*y + 1;
+}
+
+/**
+ * fitness of function_minimizer_ga for McCormick function
+ */
+double mccormick_fitness(const function_variables & variables)
+{
+	return -1*mccormick_func(variables.x, variables.y);
+}
+
+int main(int argc, char * argv[])
+{
+	cout.precision(15);
+	const int num_of_workers = argc > 1 ? max(1, atoi(argv[1])) : 2;
+
+	function_minimizer_ga local_ga(&mccormick_func, -1.5, -3, 4, 4);
+	local_ga.setParameters(100, 1000, 0.9, 0.005, -1, true);
+	local_ga.setVerbose(false);
+	local_ga.run();
+	const function_variables local_best = local_ga.getBestSolution();
+
+	const string segment_name = "/genetic_algo_mccormick_" + to_string(getpid());
+	vector<pid_t> worker_pids;
+	function_variables shm_best;
+
+	// segment is closed at the end of this block, so that workers exit
+	{
+		shm_evaluator<function_variables> _shm_evaluator(segment_name, 256);
+		if(!_shm_evaluator.isOpen())
+		{
+			return 1;
+		}
+
+		for(int w = 0; w < num_of_workers; w++)
+		{
+			pid_t pid = fork();
+			if(pid == 0)
+			{
+				const bool is_served = runShmWorker<function_variables>(segment_name, &mccormick_fitness);
+				_exit(is_served ? 0 : 1);
+			}
+			worker_pids.push_back(pid);
+		}
+
+		function_minimizer_ga shm_ga(&mccormick_func, -1.5, -3, 4, 4);
+		shm_ga.setParameters(100, 1000, 0.9, 0.005, -1, true);
+		shm_ga.setVerbose(false);
+		shm_ga.setFitnessEvaluator(&_shm_evaluator);
+		shm_ga.run();
+		shm_ga.displaySettings();
+		shm_ga.displayResults();
+		shm_best = shm_ga.getBestSolution();
+
+		cout<<"workers - "<<num_of_workers<<endl;
+		cout<<"timeouts - "<<_shm_evaluator.getNumOfTimeouts()<<endl;
+	}
+
+	for(pid_t pid : worker_pids)
+	{
+		waitpid(pid, NULL, 0);
+	}
+
+	cout<<"===================================="<<endl;
+	cout<<"McCormick function minimum value was found at"<<endl<<
+			"x = "<<shm_best.x<<", y = "<<shm_best.y<<endl<<
+			"value = "<<mccormick_func(shm_best.x, shm_best.y)<<endl;
+
+	if(shm_best.x != local_best.x || shm_best.y != local_best.y)
+	{
+		cerr<<"error minimum found with workers is not same as without workers : x = "
+				<<local_best.x<<", y = "<<local_best.y<<endl;
+		return 1;
+	}
+	cout<<"same minimum as without workers"<<endl;
+
+	return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * optimizers_comparison_demo.cpp
+ * A demo comparing number of evaluations of GA, surrogate-assisted GA, memetic GA,
+ * Differential Evolution and CMA-ES
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#define _USE_MATH_DEFINES
+
+#include <iomanip>
+#include "function_minimizer_ga.h"
+#include "continuous_function_minimizer.h"
+
+using namespace std;
+
+/**
+ * OPTIMIZERS COMPARISON DEMO
+ * ==========================
+ * Each function is minimized by function_minimizer_ga, function_minimizer_ga with
+ * self-adaptive mutation (probability and step size of each individual), with k-NN
+ * and RBF surrogate models (30% of offspring with best predicted fitness are evaluated,
+ * but at least 10% of population), with
+ * Nelder-Mead local search on its 5 best individuals (30 evaluations each),
+ * DE/rand/1/bin, DE/best/1/bin and CMA-ES (with same bounds) until known minimum is reached within 1e-6,
+ * or until 200000 evaluations. Number of evaluations of each optimizer is displayed.
+ * Offspring of a converged population are all in archive of a surrogate model and are not
+ * evaluated, so surrogate-assisted GA also stops after 200000 / population size generations.
+ *
+ */
+
+double mccormick_func(double x, double y)
+{
+	return sin(x + y) + pow((x - y), 2) - 1.5*x + 2.5*y + 1;
+}
+
+double schaffer_n4_func(double x, double y)
+{
+	return 0.5 + ((pow(cos(sin(abs(pow(x, 2) - pow(y, 2)))), 2) - 0.5) /
+			(pow((1 + (0.001*(pow(x, 2) + pow(y, 2)))), 2)));
+}
+
+double cross_in_tray_func(double x, double y)
+{
+	return -0.0001*(pow(((abs(sin(x) * sin(y) * exp(abs(100 -
+			((sqrt(pow(x, 2) + pow(y, 2))) / M_PI))))) + 1), 0.1));
+}
+
+struct test_function
+{
+	const char * name;
+	double (* function)(double x, double y);
+	double min_value_x, min_value_y, max_value_x, max_value_y;
+	double minimum;
+};
+
+const double TOLERANCE = 1e-6;
+const unsigned long long MAX_EVALUATIONS = 200000;
+
+/**
+ * run an optimizer with display of each generation switched off,
+ * and display its number of evaluations and best value
+ */
+template<typename Optimizer>
+void compare(const char * optimizer_name, Optimizer & optimizer, const test_function & func)
+{
+	optimizer.setStoppingCriterion(orCriteria(stopOnTarget(-(func.minimum + TOLERANCE)),
+			stopAfterEvaluations(MAX_EVALUATIONS)));
+	optimizer.setVerbose(false);
+	optimizer.run();
+
+	const double best_value = -optimizer.getBestFitness();
+	cout<<setw(18)<<optimizer_name
+			<<setw(14)<<optimizer.getNumOfEvaluations()
+			<<setw(22)<<best_value
+			<<setw(10)<<(best_value <= func.minimum + TOLERANCE ? "yes" : "no")<<endl;
+}
+
+int main()
+{
+	cout.precision(12);
+
+	const test_function functions[] = {
+		{"McCormick", &mccormick_func, -1.5, -3, 4, 4, -1.913222954981037},
+		{"Schaffer N.4", &schaffer_n4_func, -100, -100, 100, 100, 0.292578632035980},
+		{"Cross-In-Tray", &cross_in_tray_func, -10, -10, 10, 10, -2.062611870822739}
+	};
+
+	for(const test_function & func : functions)
+	{
+		cout<<"===================================="<<endl;
+		cout<<func.name<<" function (minimum "<<func.minimum<<")"<<endl;
+		cout<<setw(18)<<"optimizer"<<setw(14)<<"evaluations"
+				<<setw(22)<<"best value"<<setw(10)<<"reached"<<endl;
+
+		function_minimizer_ga _function_minimizer_ga(func.function,
+				func.min_value_x, func.min_value_y, func.max_value_x, func.max_value_y);
+		_function_minimizer_ga.setParameters(100, -1, 0.9, 0.005, -1, true);
+		compare("GA", _function_minimizer_ga, func);
+
+		function_minimizer_ga self_adaptive_ga(func.function,
+				func.min_value_x, func.min_value_y, func.max_value_x, func.max_value_y);
+		self_adaptive_ga.setParameters(100, -1, 0.9, 0.005, -1, true);
+		self_adaptive_ga.setSelfAdaptiveMutation(true);
+		compare("GA self-adaptive", self_adaptive_ga, func);
+
+		knn_surrogate<function_variables> knn_model;
+		function_minimizer_ga knn_ga(func.function,
+				func.min_value_x, func.min_value_y, func.max_value_x, func.max_value_y);
+		knn_ga.setParameters(100, MAX_EVALUATIONS/100, 0.9, 0.005, -1, true);
+		knn_ga.setSurrogate(&knn_model, 0.3);
+		compare("GA+k-NN surrogate", knn_ga, func);
+
+		rbf_surrogate<function_variables> rbf_model;
+		function_minimizer_ga rbf_ga(func.function,
+				func.min_value_x, func.min_value_y, func.max_value_x, func.max_value_y);
+		rbf_ga.setParameters(100, MAX_EVALUATIONS/100, 0.9, 0.005, -1, true);
+		rbf_ga.setSurrogate(&rbf_model, 0.3);
+		compare("GA+RBF surrogate", rbf_ga, func);
+
+		function_minimizer_ga memetic_ga(func.function,
+				func.min_value_x, func.min_value_y, func.max_value_x, func.max_value_y);
+		memetic_ga.setParameters(100, -1, 0.9, 0.005, -1, true);
+		memetic_ga.setLocalSearch(5, 30);
+		compare("GA+Nelder-Mead", memetic_ga, func);
+
+		function_minimizer_de de_rand(func.function,
+				func.min_value_x, func.min_value_y, func.max_value_x, func.max_value_y);
+		de_rand.setParameters(40, -1, 0.7, 0.5);
+		compare("DE/rand/1/bin", de_rand, func);
+
+		function_minimizer_de de_best(func.function,
+				func.min_value_x, func.min_value_y, func.max_value_x, func.max_value_y);
+		de_best.setParameters(40, -1, 0.7, 0.5);
+		de_best.setStrategy(function_minimizer_de::BEST_1_BIN);
+		compare("DE/best/1/bin", de_best, func);
+
+		function_minimizer_cma_es cma(func.function,
+				func.min_value_x, func.min_value_y, func.max_value_x, func.max_value_y);
+		compare("CMA-ES", cma, func);
+	}
+
+	return 0;
+}
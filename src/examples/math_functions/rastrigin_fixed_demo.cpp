@@ -0,0 +1,59 @@
+/*
+ * rastrigin_fixed_demo.cpp
+ * A demo for minimizing Rastrigin function of 5 variables (fixed size individuals)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#define _USE_MATH_DEFINES
+
+#include "fixed_function_minimizer_ga.h"
+
+using namespace std;
+
+/**
+ * RASTRIGIN FUNCTION DEMO
+ * =======================
+ * A demo run for minimizing Rastrigin function of 5 variables, each in [-5.12, 5.12],
+ * with array<double, 5> individuals (fixed_function_minimizer_ga<5>)
+ *
+ */
+
+const size_t NUM_OF_VARIABLES = 5;
+
+/**
+ * Rastrigin Function
+ *      f(x) = 10*n + sum of (x_i^2 - 10*cos(2*pi*x_i))
+ * (global minimum 0 at x = 0)
+ */
+double rastrigin_func(const array<double, NUM_OF_VARIABLES> & x)
+{
+	double value = 10*NUM_OF_VARIABLES;
+	for(size_t i = 0; i < NUM_OF_VARIABLES; i++)
+	{
+		value += x[i]*x[i] - 10*cos(2*M_PI*x[i]);
+	}
+	return value;
+}
+
+int main()
+{
+	// set precision for display to 15 decimal places
+	cout.precision(15);
+
+	fixed_function_minimizer_ga<NUM_OF_VARIABLES> _function_minimizer_ga(&rastrigin_func,
+			-5.12, 5.12);
+	_function_minimizer_ga.setParameters(200, 2000, 0.9, 0.3, -1, true);
+	_function_minimizer_ga.run();
+	_function_minimizer_ga.displaySettings();
+	_function_minimizer_ga.displayResults();
+
+	// display the actual function value after running GA
+	cout<<"===================================="<<endl;
+	cout<<"Rastrigin function minimum value was found with value = "
+			<<rastrigin_func(_function_minimizer_ga.getBestSolution())<<endl;
+
+	return 0;
+}
@@ -0,0 +1,32 @@
+/*
+ * fonseca_fleming_demo.cpp
+ * A multi-objective Genetic Algorithm demo for Fonseca-Fleming problem
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#include "fonseca_fleming_ga.h"
+
+using namespace std;
+
+/**
+ * FONSECA-FLEMING DEMO
+ * ====================
+ * A demo run for finding Pareto front of Fonseca-Fleming problem
+ * with 3 variables (x is in [-4, 4])
+ *
+ */
+
+int main()
+{
+	fonseca_fleming_ga _fonseca_fleming_ga(3);
+	_fonseca_fleming_ga.setParameters(200, 250, 0.9, 0.3, 0.3, true);
+	_fonseca_fleming_ga.setArchiveSize(100);
+	_fonseca_fleming_ga.run();
+	_fonseca_fleming_ga.displaySettings();
+	_fonseca_fleming_ga.displayResults();
+
+	return 0;
+}
@@ -0,0 +1,116 @@
+/*
+ * fonseca_fleming_ga.cpp
+ * Implementation of fonseca_fleming_ga class from "fonseca_fleming_ga.h"
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#include <cmath>
+#include "fonseca_fleming_ga.h"
+
+using namespace std;
+using namespace ga;
+
+/**
+ * IMPLEMENTATION OF FONSECA-FLEMING GENETIC ALGORITHM (fonseca_fleming_ga)
+ * ========================================================================
+ *
+ * OBJECTIVES - Negative of f1 and f2
+ *
+ * CROSSOVER OPERATOR - randomly weighted average of two parents
+ *
+ * MUTATION OPERATOR - increment/decrement each selected variable by a random value
+ *                     (random value lies in [-10% of range of variable, +10% of range of variable])
+ *
+ */
+
+/**
+ * each random engine is an independent stream of GA's seed
+ */
+void fonseca_fleming_ga::initRandomEngines()
+{
+	nsga2_ga::initRandomEngines();
+	random_engine_var = nextRandomStream();
+	random_engine_weight_parent1 = nextRandomStream();
+	random_engine_mutation = nextRandomStream();
+}
+
+/**
+ * generate a random value for each variable between its min and max value
+ */
+vector<double> fonseca_fleming_ga::getRandomIndiv()
+{
+	vector<double> indiv(NUM_OF_VARIABLES);
+	for(double & value : indiv)
+	{
+		value = _uniform_distribution_var(random_engine_var);
+	}
+	return indiv;
+}
+
+/**
+ * negative of both objectives (to minimize them)
+ */
+void fonseca_fleming_ga::getObjectives(const vector<double> & indiv,
+		vector<double> & objectives)
+{
+	const double shift = 1/sqrt((double) NUM_OF_VARIABLES);
+	double sum1 = 0, sum2 = 0;
+	for(double value : indiv)
+	{
+		sum1 += pow(value - shift, 2);
+		sum2 += pow(value + shift, 2);
+	}
+
+	objectives[0] = -(1 - exp(-sum1));
+	objectives[1] = -(1 - exp(-sum2));
+}
+
+/**
+ * display values of variables
+ */
+void fonseca_fleming_ga::displayIndiv(const vector<double> & indiv)
+{
+	for(double value : indiv)
+	{
+		cout<<value<<" ";
+	}
+	cout<<endl;
+}
+
+/**
+ * weighted average of values of first and second parent
+ * (weight is a random value uniformly distributed between 0 and 1)
+ */
+vector<double> fonseca_fleming_ga::crossOver(const crossoverParents & crossover_parents)
+{
+	const double weight_parent1 = _uniform_distribution_0_and_1(random_engine_weight_parent1);
+
+	vector<double> indiv(NUM_OF_VARIABLES);
+	for(int i = 0; i < NUM_OF_VARIABLES; i++)
+	{
+		indiv[i] = weight_parent1*(*crossover_parents.parent1)[i]
+			+ (1 - weight_parent1)*(*crossover_parents.parent2)[i];
+	}
+	return indiv;
+}
+
+/**
+ * add a random increment to each variable selected with allele mutation probability
+ * (at least one variable is always changed)
+ */
+void fonseca_fleming_ga::mutate(vector<double> & indiv)
+{
+	uniform_int_distribution<int> distrib_var(0, NUM_OF_VARIABLES - 1);
+	const int always_mutated = distrib_var(random_engine_mutation);
+	for(int i = 0; i < NUM_OF_VARIABLES; i++)
+	{
+		if(i == always_mutated || _uniform_distribution_0_and_1(random_engine_mutation)
+				< ALLELE_MUTATION_PROBABILITY)
+		{
+			indiv[i] += _uniform_distribution_increment(random_engine_mutation);
+			indiv[i] = min(VAR_MAX_VALUE, max(VAR_MIN_VALUE, indiv[i]));
+		}
+	}
+}
@@ -0,0 +1,74 @@
+/*
+ * fonseca_fleming_ga.h
+ * A multi-objective Genetic Algorithm for Fonseca-Fleming problem
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef FONSECA_FLEMING_GA_H_
+#define FONSECA_FLEMING_GA_H_
+
+#include "nsga2.h"
+
+using namespace std;
+using namespace ga;
+
+/**
+ * MULTI-OBJECTIVE GENETIC ALGORITHM FOR FONSECA-FLEMING PROBLEM (fonseca_fleming_ga)
+ * ===================================================================================
+ * Minimize both objectives for n variables in [-4, 4] :
+ *      f1(x) = 1 - exp(-sum((x_i - 1/sqrt(n))^2))
+ *      f2(x) = 1 - exp(-sum((x_i + 1/sqrt(n))^2))
+ *
+ * REPRESENTATION - A vector of n double values.
+ *
+ * CONSTRUCTOR - set the number of variables n.
+ *
+ */
+class fonseca_fleming_ga : public nsga2_ga<vector<double>, xoshiro256ss>
+{
+public :
+	explicit fonseca_fleming_ga(int num_of_variables) : nsga2_ga<vector<double>, xoshiro256ss>(2)
+	{
+		if(num_of_variables < 1)
+		{
+			cerr<<"error invalid number of variables : "<<num_of_variables<<
+					" keeping default value : "<<NUM_OF_VARIABLES<<endl;
+		}
+		else
+		{
+			NUM_OF_VARIABLES = num_of_variables;
+		}
+		initRandomEngines();
+	}
+
+protected:
+	vector<double> getRandomIndiv() override;
+	void getObjectives(const vector<double> & indiv, vector<double> & objectives) override;
+	void displayIndiv(const vector<double> & indiv) override;
+	vector<double> crossOver(const crossoverParents & crossover_parents) override;
+	void mutate(vector<double> & indiv) override;
+	void initRandomEngines() override;
+
+private:
+	int NUM_OF_VARIABLES = 3;
+
+	const double VAR_MIN_VALUE = -4;
+	const double VAR_MAX_VALUE = 4;
+
+	// random engine for generating values of variables
+	random_engine_type random_engine_var;
+	// random engine for generating values of weight for parent1
+	random_engine_type random_engine_weight_parent1;
+	// random engine for mutation
+	random_engine_type random_engine_mutation;
+
+	uniform_real_distribution<double> _uniform_distribution_0_and_1 {0, 1};
+	uniform_real_distribution<double> _uniform_distribution_var {VAR_MIN_VALUE, VAR_MAX_VALUE};
+	// step size is +- 10% of the range of variable
+	uniform_real_distribution<double> _uniform_distribution_increment
+		{-0.1*(VAR_MAX_VALUE - VAR_MIN_VALUE), 0.1*(VAR_MAX_VALUE - VAR_MIN_VALUE)};
+};
+
+#endif /* FONSECA_FLEMING_GA_H_ */
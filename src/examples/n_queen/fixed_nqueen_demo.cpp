@@ -0,0 +1,67 @@
+/*
+ * fixed_nqueen_demo.cpp
+ * A demo comparing N-QUEEN Genetic Algorithm with vector and fixed size (std::array) individuals
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#include <chrono>
+#include <iomanip>
+#include "nqueen_ga.h"
+#include "fixed_nqueen_ga.h"
+
+using namespace std;
+
+/**
+ * FIXED SIZE N-QUEEN DEMO
+ * =======================
+ * Solves N-QUEEN problem with N = 32 with the same parameters by :
+ * nqueen_genetic_algo (vector<int> individuals, N given at run time)
+ * fixed_nqueen_genetic_algo<32> (array<int, 32> individuals, N known at compile time)
+ * and shows generations, evaluations and time of each run and of each evaluation.
+ *
+ */
+
+const int N_QUEEN_NUM = 32;
+
+template<typename GA>
+void runAndReport(GA & genetic_algo, const string & name)
+{
+	genetic_algo.setParameters(100, 2000, 0.9, 0.1, 0.03, true);
+	genetic_algo.setVerbose(false);
+	const chrono::steady_clock::time_point start_time = chrono::steady_clock::now();
+	genetic_algo.run();
+	const double elapsed_seconds =
+			chrono::duration<double>(chrono::steady_clock::now() - start_time).count();
+
+	cout<<left<<setw(32)<<name<<right<<setw(12)<<genetic_algo.getNumOfGenerations()
+			<<setw(14)<<genetic_algo.getNumOfEvaluations()
+			<<setw(14)<<genetic_algo.getBestFitness()
+			<<setw(12)<<fixed<<setprecision(3)<<elapsed_seconds
+			<<setw(14)<<setprecision(3)
+			<<1e9*elapsed_seconds/max(1ULL, genetic_algo.getNumOfEvaluations())<<endl;
+	cout.unsetf(ios::floatfield);
+}
+
+int main()
+{
+	cout<<left<<setw(32)<<"individual"<<right<<setw(12)<<"generations"<<setw(14)<<"evaluations"
+			<<setw(14)<<"best fitness"<<setw(12)<<"seconds"<<setw(14)<<"ns/evaluation"<<endl;
+
+	nqueen_genetic_algo _nqueen_genetic_algo(N_QUEEN_NUM);
+	runAndReport(_nqueen_genetic_algo, "vector<int> (N at run time)");
+
+	fixed_nqueen_genetic_algo<N_QUEEN_NUM> _fixed_nqueen_genetic_algo;
+	runAndReport(_fixed_nqueen_genetic_algo, "array<int, 32> (N at compile time)");
+
+	cout<<endl<<"solution of fixed size GA :"<<endl;
+	for(int position : _fixed_nqueen_genetic_algo.getBestSolution())
+	{
+		cout<<position<<" ";
+	}
+	cout<<endl;
+
+	return 0;
+}
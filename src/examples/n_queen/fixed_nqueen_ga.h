@@ -0,0 +1,326 @@
+/*
+ * fixed_nqueen_ga.h
+ * N-QUEEN Genetic Algorithm with N known at compile time (std::array individuals)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef FIXED_NQUEEN_GA_H_
+#define FIXED_NQUEEN_GA_H_
+
+#include <array>
+#include "ga.h"
+#include "util/permutations.h"
+#include "nqueen_conflict_kernel.h"
+
+using namespace std;
+using namespace ga;
+
+/**
+ * N-QUEEN GENETIC ALGORITHM FOR A FIXED N (fixed_nqueen_genetic_algo)
+ * ===================================================================
+ * Same representation, fitness and operators as nqueen_genetic_algo, but an individual
+ * is an array<int, N> instead of vector<int> :
+ *
+ * - individuals of a generation are one block of memory (no heap allocation for each
+ *   individual), and copying an individual is a fixed size copy
+ * - loops have compile time bounds, so that compiler can unroll and vectorize them
+ * - temporary values of operators are arrays on stack (no arena or heap)
+ *
+ * It is meant for small N (e.g. up to a few hundreds), since every temporary array is on
+ * stack. Operators only use given random engines, so it also runs in large population mode.
+ *
+ */
+template<size_t N>
+class fixed_nqueen_genetic_algo : public simple_ga<array<int, N>, xoshiro256ss>
+{
+	static_assert(N >= 4, "solutions may not exist for N < 4 in N-queen problem");
+
+public :
+	typedef array<int, N> indiv_type;
+	typedef simple_ga<indiv_type, xoshiro256ss> base_ga;
+	typedef typename base_ga::random_engine_type random_engine_type;
+	typedef typename base_ga::crossoverParents crossoverParents;
+
+	fixed_nqueen_genetic_algo()
+	{
+		initRandomEngines();
+	}
+
+protected:
+	indiv_type getRandomIndiv() override;
+	bool generateRandomIndiv(indiv_type & indiv, random_engine_type & random_engine) override;
+	void initRandomEngines() override;
+	double getFitness(const indiv_type & indiv) override;
+	bool getBatchFitness(const indiv_type * const * indivs, double * fitness,
+			size_t num_of_indivs) override;
+	void displayIndiv(const indiv_type & indiv) override;
+	indiv_type crossOver(const crossoverParents & crossover_parents) override;
+	void crossOverInPlace(const crossoverParents & crossover_parents,
+			indiv_type & offspring) override;
+	bool crossOverWithEngine(const crossoverParents & crossover_parents,
+			indiv_type & offspring, random_engine_type & random_engine) override;
+	void mutate(indiv_type & indiv) override;
+	bool mutateWithEngine(indiv_type & indiv, random_engine_type & random_engine) override;
+	bool shouldStop() override;
+
+private:
+	// random individual generation engine
+	random_engine_type random_engine_init;
+	// crossover (shuffle and point) random engine
+	random_engine_type random_engine_crossover;
+	// mutation (allele and conflict selection) random engine
+	random_engine_type random_engine_mutation;
+
+	// instruction set of batched conflict kernel (best one of this CPU)
+	const nqueen_kernel_isa kernel_isa = detectNqueenKernelIsa();
+
+	void onePointOrderCrossover(const crossoverParents & crossover_parents,
+			indiv_type & offspring, random_engine_type & random_engine);
+	void conflictSwapMutation(indiv_type & indiv, random_engine_type & random_engine);
+};
+
+
+/**
+ * IMPLEMENTATION OF METHODS OF CLASS
+ * ==================================
+ */
+
+template<size_t N>
+typename fixed_nqueen_genetic_algo<N>::indiv_type fixed_nqueen_genetic_algo<N>::getRandomIndiv()
+{
+	indiv_type indiv;
+	fillRandomPermutation(indiv, random_engine_init);
+	return indiv;
+}
+
+template<size_t N>
+bool fixed_nqueen_genetic_algo<N>::generateRandomIndiv(indiv_type & indiv,
+		random_engine_type & random_engine)
+{
+	fillRandomPermutation(indiv, random_engine);
+	return true;
+}
+
+template<size_t N>
+void fixed_nqueen_genetic_algo<N>::initRandomEngines()
+{
+	random_engine_init = this->nextRandomStream();
+	random_engine_crossover = this->nextRandomStream();
+	random_engine_mutation = this->nextRandomStream();
+}
+
+/**
+ * negative of number of conflicting pairs (same as nqueen_genetic_algo::getFitness
+ * for permutations)
+ */
+template<size_t N>
+double fixed_nqueen_genetic_algo<N>::getFitness(const indiv_type & indiv)
+{
+	int conflicts = 0;
+	for(size_t i = 1; i < N; i++)
+	{
+		for(size_t j = 0; j < i; j++)
+		{
+			const int difference = abs(indiv[i] - indiv[j]);
+			conflicts += (difference == 0) | (difference == (int) (i - j));
+		}
+	}
+	return - conflicts;
+}
+
+/**
+ * fitness of NQUEEN_BATCH_WIDTH individuals at once with batched conflict kernel
+ * (interleaved rows and line counts are on stack)
+ */
+template<size_t N>
+bool fixed_nqueen_genetic_algo<N>::getBatchFitness(const indiv_type * const * indivs,
+		double * fitness, size_t num_of_indivs)
+{
+	int32_t rows[N*NQUEEN_BATCH_WIDTH];
+	int32_t line_counts[(5*N - 2)*NQUEEN_BATCH_WIDTH] = {};
+	int32_t conflicts[NQUEEN_BATCH_WIDTH];
+	for(size_t first = 0; first < num_of_indivs; first += NQUEEN_BATCH_WIDTH)
+	{
+		const size_t batch_size = min(NQUEEN_BATCH_WIDTH, num_of_indivs - first);
+		for(size_t lane = 0; lane < NQUEEN_BATCH_WIDTH; lane++)
+		{
+			// unused lanes get rows of first individual
+			const indiv_type & indiv = *indivs[first + (lane < batch_size ? lane : 0)];
+			for(size_t column = 0; column < N; column++)
+			{
+				rows[column*NQUEEN_BATCH_WIDTH + lane] = indiv[column];
+			}
+		}
+		countNqueenConflicts(rows, N, conflicts, NULL, line_counts, kernel_isa);
+		for(size_t lane = 0; lane < batch_size; lane++)
+		{
+			fitness[first + lane] = - conflicts[lane];
+		}
+	}
+	return true;
+}
+
+template<size_t N>
+void fixed_nqueen_genetic_algo<N>::displayIndiv(const indiv_type & indiv)
+{
+	for(int position : indiv)
+	{
+		cout<<position<<" ";
+	}
+	cout<<endl;
+}
+
+template<size_t N>
+typename fixed_nqueen_genetic_algo<N>::indiv_type fixed_nqueen_genetic_algo<N>::crossOver(
+		const crossoverParents & crossover_parents)
+{
+	indiv_type offspring;
+	onePointOrderCrossover(crossover_parents, offspring, random_engine_crossover);
+	return offspring;
+}
+
+template<size_t N>
+void fixed_nqueen_genetic_algo<N>::crossOverInPlace(const crossoverParents & crossover_parents,
+		indiv_type & offspring)
+{
+	onePointOrderCrossover(crossover_parents, offspring, random_engine_crossover);
+}
+
+template<size_t N>
+bool fixed_nqueen_genetic_algo<N>::crossOverWithEngine(const crossoverParents & crossover_parents,
+		indiv_type & offspring, random_engine_type & random_engine)
+{
+	onePointOrderCrossover(crossover_parents, offspring, random_engine);
+	return true;
+}
+
+/**
+ * 1-point order crossover (see nqueen_genetic_algo::onePointOrderCrossover),
+ * with temporary values on stack
+ */
+template<size_t N>
+void fixed_nqueen_genetic_algo<N>::onePointOrderCrossover(
+		const crossoverParents & crossover_parents, indiv_type & indiv,
+		random_engine_type & random_engine)
+{
+	// shuffle parent1 and parent2 to remove any bias
+	const bool is_swapped = uniform_int_distribution<int>(0, 1)(random_engine) == 1;
+	const indiv_type & parent1 = is_swapped ? *crossover_parents.parent2 : *crossover_parents.parent1;
+	const indiv_type & parent2 = is_swapped ? *crossover_parents.parent1 : *crossover_parents.parent2;
+
+	const size_t crossover_point1 = uniform_int_distribution<size_t>(1, N - 1)(random_engine);
+
+	// assigned_map[value] is true if value is already in offspring
+	array<bool, N> assigned_map;
+	assigned_map.fill(false);
+	for(size_t i = 0; i < crossover_point1; i++)
+	{
+		indiv[i] = parent1[i];
+		assigned_map[parent1[i]] = true;
+	}
+
+	// copy from parent2 with no repetition
+	array<int, N> unassigned_positions;
+	size_t num_of_unassigned = 0;
+	for(size_t i = crossover_point1; i < N; i++)
+	{
+		const int ith_value = parent2[i];
+		if(assigned_map[ith_value])
+		{
+			unassigned_positions[num_of_unassigned++] = i;
+		}
+		else
+		{
+			indiv[i] = ith_value;
+			assigned_map[ith_value] = true;
+		}
+	}
+
+	// fill unassigned positions with remaining values in the order of parent2
+	size_t k = 0;
+	for(size_t i = 0; i < N && k < num_of_unassigned; i++)
+	{
+		if(!assigned_map[parent2[i]])
+		{
+			indiv[unassigned_positions[k++]] = parent2[i];
+		}
+	}
+
+	if(k != num_of_unassigned)
+	{
+		cerr<<"error in crossover, returning one of the parent - "
+				<<"unassigned values do not fit exactly in unassigned positions - "
+				<<k<<" => "<<num_of_unassigned<<endl;
+		indiv = parent1;
+	}
+}
+
+template<size_t N>
+void fixed_nqueen_genetic_algo<N>::mutate(indiv_type & indiv)
+{
+	conflictSwapMutation(indiv, random_engine_mutation);
+}
+
+template<size_t N>
+bool fixed_nqueen_genetic_algo<N>::mutateWithEngine(indiv_type & indiv,
+		random_engine_type & random_engine)
+{
+	conflictSwapMutation(indiv, random_engine);
+	return true;
+}
+
+/**
+ * swap each allele (with probability ALLELE_MUTATION_PROBABILITY) with a randomly selected
+ * conflicting position, each conflicting position is used once (unlike nqueen_genetic_algo,
+ * a position with several conflicts is not more likely to be selected)
+ */
+template<size_t N>
+void fixed_nqueen_genetic_algo<N>::conflictSwapMutation(indiv_type & indiv,
+		random_engine_type & random_engine)
+{
+	// positions in conflict with any other position (each listed once)
+	array<int32_t, N> position_conflicts;
+	array<int32_t, 5*N - 2> line_counts;
+	line_counts.fill(0);
+	countNqueenIndivConflicts(indiv.data(), N, line_counts.data(), position_conflicts.data());
+	array<int, N> conflicting_positions;
+	size_t num_of_conflicting = 0;
+	for(size_t i = 0; i < N; i++)
+	{
+		if(position_conflicts[i] > 0)
+		{
+			conflicting_positions[num_of_conflicting++] = i;
+		}
+	}
+
+	uniform_real_distribution<double> uniform_double_distribution(0.0, 1.0);
+	for(size_t i = 0; i < N && num_of_conflicting > 0; i++)
+	{
+		if(uniform_double_distribution(random_engine) < this->ALLELE_MUTATION_PROBABILITY)
+		{
+			uniform_int_distribution<size_t> distrib_conflict(0, num_of_conflicting - 1);
+			const size_t jth_random = distrib_conflict(random_engine);
+			swap(indiv[i], indiv[conflicting_positions[jth_random]]);
+
+			// remove this conflicting position
+			for(size_t k = jth_random + 1; k < num_of_conflicting; k++)
+			{
+				conflicting_positions[k - 1] = conflicting_positions[k];
+			}
+			num_of_conflicting--;
+		}
+	}
+}
+
+/**
+ * stop when a solution is found with no conflict
+ */
+template<size_t N>
+bool fixed_nqueen_genetic_algo<N>::shouldStop()
+{
+	return this->best_fitness >= 0 || base_ga::shouldStop();
+}
+
+#endif /* FIXED_NQUEEN_GA_H_ */
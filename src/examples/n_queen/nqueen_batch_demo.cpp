@@ -0,0 +1,66 @@
+/*
+ * nqueen_batch_demo.cpp
+ * A demo of running many N-QUEEN GAs (seed and parameter sweep) in one process
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#include <fstream>
+#include "nqueen_ga.h"
+#include "batch_runner.h"
+
+using namespace std;
+
+/**
+ * N-QUEEN BATCH DEMO
+ * ==================
+ * 20 runs (seeds 1 to 20) of each of three configurations for N = 50 are run
+ * on all cores : two mutation probabilities, and memetic mode with min-conflicts
+ * local search. Each run stops when a solution is found (target fitness 0)
+ * or after 300 generations.
+ *
+ * Summary of each configuration is displayed as CSV, and all results
+ * are written as JSON to "nqueen_batch_results.json".
+ *
+ */
+
+int main()
+{
+	const int N = 50;
+	const size_t NUM_OF_RUNS = 20;
+	const double TARGET_FITNESS = 0;
+
+	batch_runner runner(max(1u, thread::hardware_concurrency()));
+
+	runner.addRuns("mutation 0.1", NUM_OF_RUNS, 1, TARGET_FITNESS, [N]()
+	{
+		nqueen_genetic_algo * gaP = new nqueen_genetic_algo(N);
+		gaP->setParameters(100, 300, 0.9, 0.1, 0.03, true);
+		return gaP;
+	});
+
+	runner.addRuns("mutation 0.3", NUM_OF_RUNS, 1, TARGET_FITNESS, [N]()
+	{
+		nqueen_genetic_algo * gaP = new nqueen_genetic_algo(N);
+		gaP->setParameters(100, 300, 0.9, 0.3, 0.03, true);
+		return gaP;
+	});
+
+	runner.addRuns("memetic (5 elites x 20 steps)", NUM_OF_RUNS, 1, TARGET_FITNESS, [N]()
+	{
+		nqueen_genetic_algo * gaP = new nqueen_genetic_algo(N);
+		gaP->setParameters(100, 300, 0.9, 0.1, 0.03, true);
+		gaP->setLocalSearch(5, 20);
+		return gaP;
+	});
+
+	runner.run();
+	runner.writeCsv(cout);
+
+	ofstream json_file("nqueen_batch_results.json");
+	runner.writeJson(json_file);
+
+	return 0;
+}
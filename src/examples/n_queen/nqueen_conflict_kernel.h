@@ -0,0 +1,397 @@
+/*
+ * nqueen_conflict_kernel.h
+ * Batched conflict counting of N-Queen individuals (AVX-512, AVX2 or scalar)
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ */
+
+#ifndef NQUEEN_CONFLICT_KERNEL_H_
+#define NQUEEN_CONFLICT_KERNEL_H_
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define NQUEEN_KERNEL_X86
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+/**
+ * BATCHED N-QUEEN CONFLICT KERNEL
+ * ===============================
+ * Counts conflicts of NQUEEN_BATCH_WIDTH (16) individuals at once. Individuals of a
+ * batch are interleaved, so that rows of one column of all individuals are next to
+ * each other (one vector) :
+ *
+ * rows[column*NQUEEN_BATCH_WIDTH + lane] = row of queen in column of individual lane
+ *
+ * Queens are counted on each line of the board (row, diagonal and anti-diagonal), as
+ * in nqueen_genetic_algo::localSearch. A queen placed on a line conflicts with every
+ * queen already on it, so each column adds the counts of its three lines and then
+ * increments them, which is O(N) for an individual instead of checking all pairs.
+ * Counts are the same as nqueen_genetic_algo::getFitness (for rows 0 to N - 1).
+ *
+ * Counts of lines are kept for each lane (line_counts, of nqueenLineCountsSize(n)
+ * values), which must be all zero on entry and are all zero again on return, so
+ * they are allocated once and are not cleared for each batch.
+ *
+ * Optionally the kernel also gives conflicts of each position, i.e. number of other
+ * queens on lines of its queen (in the same interleaved layout). Both positions of
+ * each conflicting pair are non-zero, so it is a conflict mask of the individual
+ * (e.g. for mutation), and it adds up to twice the conflicts of the individual.
+ * countNqueenIndivConflicts counts a single individual the same way.
+ *
+ * Instruction set is chosen at run time (detectNqueenKernelIsa), so the program is not
+ * compiled for a specific CPU. Lines of 16 lanes are read and written with one gather
+ * and one scatter with AVX-512, AVX2 gathers counts of 8 lanes and updates them one by
+ * one (it has no scatter). Scalar kernel is used on other CPUs and compilers.
+ *
+ */
+const size_t NQUEEN_BATCH_WIDTH = 16;
+
+/**
+ * largest N for which batched kernel is faster than counting one individual at a time
+ * (countNqueenIndivConflicts). Kernel reads and writes line counts of all lanes
+ * ((5N - 2)*16 values) at random, so for a larger N they do not fit in L1 cache
+ * and it is slower (see nqueen_kernel_bench).
+ */
+const int NQUEEN_BATCH_MAX_N = 128;
+
+enum nqueen_kernel_isa { NQUEEN_KERNEL_SCALAR, NQUEEN_KERNEL_AVX2, NQUEEN_KERNEL_AVX512 };
+
+/**
+ * best instruction set of this CPU for the kernel
+ */
+inline nqueen_kernel_isa detectNqueenKernelIsa()
+{
+#ifdef NQUEEN_KERNEL_X86
+	if(__builtin_cpu_supports("avx512f"))
+	{
+		return NQUEEN_KERNEL_AVX512;
+	}
+	if(__builtin_cpu_supports("avx2"))
+	{
+		return NQUEEN_KERNEL_AVX2;
+	}
+#endif
+	return NQUEEN_KERNEL_SCALAR;
+}
+
+inline const char * getNqueenKernelIsaName(nqueen_kernel_isa isa)
+{
+	switch(isa)
+	{
+	case NQUEEN_KERNEL_AVX512:
+		return "avx512";
+	case NQUEEN_KERNEL_AVX2:
+		return "avx2";
+	default:
+		return "scalar";
+	}
+}
+
+/**
+ * number of line counts of a board of n columns for given number of lanes :
+ * n rows, then 2n - 1 diagonals (row + column), then 2n - 1 anti-diagonals
+ * (row - column + n - 1)
+ */
+inline size_t nqueenLineCountsSize(int n, size_t num_of_lanes = NQUEEN_BATCH_WIDTH)
+{
+	return (size_t) (5*n - 2)*num_of_lanes;
+}
+
+/**
+ * put individuals (at most NQUEEN_BATCH_WIDTH, each of n rows) into interleaved rows,
+ * unused lanes get rows of first individual (their counts are not used)
+ */
+inline void loadNqueenBatch(const vector<int> * const * indivs, size_t num_of_indivs,
+		int n, int32_t * rows)
+{
+	for(size_t lane = 0; lane < NQUEEN_BATCH_WIDTH; lane++)
+	{
+		const vector<int> & indiv = *indivs[lane < num_of_indivs ? lane : 0];
+		for(int column = 0; column < n; column++)
+		{
+			rows[column*NQUEEN_BATCH_WIDTH + lane] = indiv[column];
+		}
+	}
+}
+
+// first line of diagonals (row + column) and of anti-diagonals (row - column, which starts
+// at -(n - 1)) in line counts
+inline int nqueenDiagonalLine(int n)
+{
+	return n;
+}
+inline int nqueenAntiDiagonalLine(int n)
+{
+	return 3*n - 1 + (n - 1);
+}
+
+/**
+ * conflicts of a single individual (rows of its n columns). line_counts has
+ * nqueenLineCountsSize(n, 1) values, all zero on entry and on return. Optionally
+ * (if not NULL, n values each) it gives conflicts of each position in position_conflicts,
+ * and conflicts of each position with queens of earlier columns in earlier_conflicts
+ * (only later position of each conflicting pair, as in pairwise counting).
+ */
+inline int32_t countNqueenIndivConflicts(const int * rows, int n, int32_t * line_counts,
+		int32_t * position_conflicts = NULL, int32_t * earlier_conflicts = NULL)
+{
+	int32_t * const row_counts = line_counts;
+	int32_t * const diagonal_counts = line_counts + nqueenDiagonalLine(n);
+	int32_t * const anti_diagonal_counts = line_counts + nqueenAntiDiagonalLine(n);
+
+	int32_t conflicts = 0;
+	for(int column = 0; column < n; column++)
+	{
+		const int row = rows[column];
+		const int32_t column_conflicts = row_counts[row]++ + diagonal_counts[row + column]++
+				+ anti_diagonal_counts[row - column]++;
+		if(earlier_conflicts != NULL)
+		{
+			earlier_conflicts[column] = column_conflicts;
+		}
+		conflicts += column_conflicts;
+	}
+	for(int column = 0; column < n && position_conflicts != NULL; column++)
+	{
+		const int row = rows[column];
+		position_conflicts[column] = row_counts[row] + diagonal_counts[row + column]
+				+ anti_diagonal_counts[row - column] - 3;
+	}
+	for(int column = 0; column < n; column++)
+	{
+		const int row = rows[column];
+		row_counts[row] = 0;
+		diagonal_counts[row + column] = 0;
+		anti_diagonal_counts[row - column] = 0;
+	}
+	return conflicts;
+}
+
+inline void countNqueenConflictsScalar(const int32_t * rows, int n, int32_t * conflicts,
+		int32_t * position_conflicts, int32_t * line_counts)
+{
+	const size_t W = NQUEEN_BATCH_WIDTH;
+	int32_t * const row_counts = line_counts;
+	int32_t * const diagonal_counts = line_counts + nqueenDiagonalLine(n)*W;
+	int32_t * const anti_diagonal_counts = line_counts + nqueenAntiDiagonalLine(n)*W;
+
+	for(size_t lane = 0; lane < W; lane++)
+	{
+		conflicts[lane] = 0;
+	}
+	for(int column = 0; column < n; column++)
+	{
+		const int32_t * const rows_c = rows + column*W;
+		for(size_t lane = 0; lane < W; lane++)
+		{
+			const int row = rows_c[lane];
+			conflicts[lane] += row_counts[row*W + lane]++
+					+ diagonal_counts[(row + column)*W + lane]++
+					+ anti_diagonal_counts[(row - column)*(int) W + (int) lane]++;
+		}
+	}
+
+	for(int column = 0; column < n && position_conflicts != NULL; column++)
+	{
+		const int32_t * const rows_c = rows + column*W;
+		for(size_t lane = 0; lane < W; lane++)
+		{
+			const int row = rows_c[lane];
+			position_conflicts[column*W + lane] = row_counts[row*W + lane]
+					+ diagonal_counts[(row + column)*W + lane]
+					+ anti_diagonal_counts[(row - column)*(int) W + (int) lane] - 3;
+		}
+	}
+
+	for(int column = 0; column < n; column++)
+	{
+		const int32_t * const rows_c = rows + column*W;
+		for(size_t lane = 0; lane < W; lane++)
+		{
+			const int row = rows_c[lane];
+			row_counts[row*W + lane] = 0;
+			diagonal_counts[(row + column)*W + lane] = 0;
+			anti_diagonal_counts[(row - column)*(int) W + (int) lane] = 0;
+		}
+	}
+}
+
+#ifdef NQUEEN_KERNEL_X86
+/**
+ * index of count of each line of queens of a column in line counts (for 8 lanes from half)
+ */
+__attribute__((target("avx2")))
+inline void nqueenLineIndicesAvx2(const int32_t * rows, int n, int column, size_t half,
+		__m256i & row_index, __m256i & diagonal_index, __m256i & anti_diagonal_index)
+{
+	const __m256i row = _mm256_loadu_si256((const __m256i *)
+			(rows + column*NQUEEN_BATCH_WIDTH + half));
+	const __m256i lane = _mm256_setr_epi32(half, half + 1, half + 2, half + 3,
+			half + 4, half + 5, half + 6, half + 7);
+	row_index = _mm256_add_epi32(_mm256_slli_epi32(row, 4), lane);
+	diagonal_index = _mm256_add_epi32(_mm256_slli_epi32(_mm256_add_epi32(row,
+			_mm256_set1_epi32(nqueenDiagonalLine(n) + column)), 4), lane);
+	anti_diagonal_index = _mm256_add_epi32(_mm256_slli_epi32(_mm256_add_epi32(row,
+			_mm256_set1_epi32(nqueenAntiDiagonalLine(n) - column)), 4), lane);
+}
+
+__attribute__((target("avx2")))
+inline void countNqueenConflictsAvx2(const int32_t * rows, int n, int32_t * conflicts,
+		int32_t * position_conflicts, int32_t * line_counts)
+{
+	const __m256i three = _mm256_set1_epi32(3);
+	int32_t indices[3*NQUEEN_BATCH_WIDTH];
+
+	__m256i total[2] = {_mm256_setzero_si256(), _mm256_setzero_si256()};
+	__m256i row_index, diagonal_index, anti_diagonal_index;
+	for(int column = 0; column < n; column++)
+	{
+		for(size_t half = 0; half < NQUEEN_BATCH_WIDTH; half += 8)
+		{
+			nqueenLineIndicesAvx2(rows, n, column, half, row_index, diagonal_index,
+					anti_diagonal_index);
+			total[half/8] = _mm256_add_epi32(total[half/8], _mm256_add_epi32(
+					_mm256_i32gather_epi32(line_counts, row_index, 4), _mm256_add_epi32(
+					_mm256_i32gather_epi32(line_counts, diagonal_index, 4),
+					_mm256_i32gather_epi32(line_counts, anti_diagonal_index, 4))));
+			_mm256_storeu_si256((__m256i *) (indices + half), row_index);
+			_mm256_storeu_si256((__m256i *) (indices + NQUEEN_BATCH_WIDTH + half), diagonal_index);
+			_mm256_storeu_si256((__m256i *) (indices + 2*NQUEEN_BATCH_WIDTH + half),
+					anti_diagonal_index);
+		}
+		// no scatter in AVX2, lanes are at different indices
+		for(size_t k = 0; k < 3*NQUEEN_BATCH_WIDTH; k++)
+		{
+			line_counts[indices[k]]++;
+		}
+	}
+	_mm256_storeu_si256((__m256i *) conflicts, total[0]);
+	_mm256_storeu_si256((__m256i *) (conflicts + 8), total[1]);
+
+	for(int column = 0; column < n && position_conflicts != NULL; column++)
+	{
+		for(size_t half = 0; half < NQUEEN_BATCH_WIDTH; half += 8)
+		{
+			nqueenLineIndicesAvx2(rows, n, column, half, row_index, diagonal_index,
+					anti_diagonal_index);
+			_mm256_storeu_si256((__m256i *) (position_conflicts + column*NQUEEN_BATCH_WIDTH + half),
+					_mm256_sub_epi32(_mm256_add_epi32(
+					_mm256_i32gather_epi32(line_counts, row_index, 4), _mm256_add_epi32(
+					_mm256_i32gather_epi32(line_counts, diagonal_index, 4),
+					_mm256_i32gather_epi32(line_counts, anti_diagonal_index, 4))), three));
+		}
+	}
+
+	for(int column = 0; column < n; column++)
+	{
+		for(size_t half = 0; half < NQUEEN_BATCH_WIDTH; half += 8)
+		{
+			nqueenLineIndicesAvx2(rows, n, column, half, row_index, diagonal_index,
+					anti_diagonal_index);
+			_mm256_storeu_si256((__m256i *) (indices + half), row_index);
+			_mm256_storeu_si256((__m256i *) (indices + NQUEEN_BATCH_WIDTH + half), diagonal_index);
+			_mm256_storeu_si256((__m256i *) (indices + 2*NQUEEN_BATCH_WIDTH + half),
+					anti_diagonal_index);
+		}
+		for(size_t k = 0; k < 3*NQUEEN_BATCH_WIDTH; k++)
+		{
+			line_counts[indices[k]] = 0;
+		}
+	}
+}
+
+/**
+ * index of count of each line of queens of a column in line counts (for all lanes)
+ */
+__attribute__((target("avx512f")))
+inline void nqueenLineIndicesAvx512(const int32_t * rows, int n, int column,
+		__m512i & row_index, __m512i & diagonal_index, __m512i & anti_diagonal_index)
+{
+	const __m512i lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+			8, 9, 10, 11, 12, 13, 14, 15);
+	const __m512i row = _mm512_loadu_si512(rows + column*NQUEEN_BATCH_WIDTH);
+	row_index = _mm512_add_epi32(_mm512_slli_epi32(row, 4), lanes);
+	diagonal_index = _mm512_add_epi32(_mm512_slli_epi32(_mm512_add_epi32(row,
+			_mm512_set1_epi32(nqueenDiagonalLine(n) + column)), 4), lanes);
+	anti_diagonal_index = _mm512_add_epi32(_mm512_slli_epi32(_mm512_add_epi32(row,
+			_mm512_set1_epi32(nqueenAntiDiagonalLine(n) - column)), 4), lanes);
+}
+
+__attribute__((target("avx512f")))
+inline void countNqueenConflictsAvx512(const int32_t * rows, int n, int32_t * conflicts,
+		int32_t * position_conflicts, int32_t * line_counts)
+{
+	const __m512i one = _mm512_set1_epi32(1);
+	const __m512i three = _mm512_set1_epi32(3);
+	const __m512i zero = _mm512_setzero_si512();
+
+	__m512i total = zero;
+	__m512i row_index, diagonal_index, anti_diagonal_index;
+	for(int column = 0; column < n; column++)
+	{
+		nqueenLineIndicesAvx512(rows, n, column, row_index, diagonal_index, anti_diagonal_index);
+		// lanes are at different indices, so a scatter has no collisions
+		const __m512i row_count = _mm512_i32gather_epi32(row_index, line_counts, 4);
+		const __m512i diagonal_count = _mm512_i32gather_epi32(diagonal_index, line_counts, 4);
+		const __m512i anti_diagonal_count = _mm512_i32gather_epi32(anti_diagonal_index,
+				line_counts, 4);
+		total = _mm512_add_epi32(total, _mm512_add_epi32(row_count,
+				_mm512_add_epi32(diagonal_count, anti_diagonal_count)));
+		_mm512_i32scatter_epi32(line_counts, row_index, _mm512_add_epi32(row_count, one), 4);
+		_mm512_i32scatter_epi32(line_counts, diagonal_index,
+				_mm512_add_epi32(diagonal_count, one), 4);
+		_mm512_i32scatter_epi32(line_counts, anti_diagonal_index,
+				_mm512_add_epi32(anti_diagonal_count, one), 4);
+	}
+	_mm512_storeu_si512(conflicts, total);
+
+	for(int column = 0; column < n && position_conflicts != NULL; column++)
+	{
+		nqueenLineIndicesAvx512(rows, n, column, row_index, diagonal_index, anti_diagonal_index);
+		_mm512_storeu_si512(position_conflicts + column*NQUEEN_BATCH_WIDTH, _mm512_sub_epi32(
+				_mm512_add_epi32(_mm512_i32gather_epi32(row_index, line_counts, 4),
+				_mm512_add_epi32(_mm512_i32gather_epi32(diagonal_index, line_counts, 4),
+				_mm512_i32gather_epi32(anti_diagonal_index, line_counts, 4))), three));
+	}
+
+	for(int column = 0; column < n; column++)
+	{
+		nqueenLineIndicesAvx512(rows, n, column, row_index, diagonal_index, anti_diagonal_index);
+		_mm512_i32scatter_epi32(line_counts, row_index, zero, 4);
+		_mm512_i32scatter_epi32(line_counts, diagonal_index, zero, 4);
+		_mm512_i32scatter_epi32(line_counts, anti_diagonal_index, zero, 4);
+	}
+}
+#endif
+
+/**
+ * count conflicts of each individual of interleaved rows (n columns) in conflicts,
+ * and conflicts of each position in position_conflicts (if it is not NULL), with
+ * given instruction set. line_counts has nqueenLineCountsSize(n) values, all zero.
+ */
+inline void countNqueenConflicts(const int32_t * rows, int n, int32_t * conflicts,
+		int32_t * position_conflicts, int32_t * line_counts, nqueen_kernel_isa isa)
+{
+#ifdef NQUEEN_KERNEL_X86
+	if(isa == NQUEEN_KERNEL_AVX512)
+	{
+		countNqueenConflictsAvx512(rows, n, conflicts, position_conflicts, line_counts);
+		return;
+	}
+	if(isa == NQUEEN_KERNEL_AVX2)
+	{
+		countNqueenConflictsAvx2(rows, n, conflicts, position_conflicts, line_counts);
+		return;
+	}
+#endif
+	countNqueenConflictsScalar(rows, n, conflicts, position_conflicts, line_counts);
+}
+
+#endif /* NQUEEN_CONFLICT_KERNEL_H_ */
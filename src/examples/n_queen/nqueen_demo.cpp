@@ -18,13 +18,47 @@ using namespace std;
  *
  * Tune your parameter settings if you are changing N.
  *
+ * Statistics of each generation are also written to a telemetry file when
+ * its path is given as argument (watch it with "telemetry_to_csv FILE --follow").
+ * With "--delta N", fitness of offspring is calculated from changes of their parent
+ * (delta evaluation) and every N-th generation is fully evaluated.
  *
  */
 
-int main()
+int main(int argc, char * argv[])
 {
+	string telemetry_path;
+	unsigned full_evaluation_interval = 0;
+	for(int i = 1; i < argc; i++)
+	{
+		const string option = argv[i];
+		if(option == "--delta" && i + 1 < argc)
+		{
+			full_evaluation_interval = (unsigned) max(0, atoi(argv[++i]));
+		}
+		else if(telemetry_path.empty() && option.compare(0, 2, "--") != 0)
+		{
+			telemetry_path = option;
+		}
+		else
+		{
+			cerr<<"usage : "<<argv[0]<<" [TELEMETRY_FILE] [--delta N]"<<endl;
+			return 2;
+		}
+	}
+
 	nqueen_genetic_algo _nqueen_genetic_algo(100);
+	unique_ptr<telemetry_writer> telemetry_writerP;
+	if(!telemetry_path.empty())
+	{
+		telemetry_writerP.reset(new telemetry_writer(telemetry_path));
+		_nqueen_genetic_algo.setTelemetry(telemetry_writerP.get());
+	}
+	_nqueen_genetic_algo.setDeltaEvaluation(full_evaluation_interval);
 	_nqueen_genetic_algo.setParameters(100, -1, 0.9, 0.1, 0.03, true);
+	_nqueen_genetic_algo.setInitializationThreads(max(1u, thread::hardware_concurrency()));
+	_nqueen_genetic_algo.setDiversityTracking(true);
+	_nqueen_genetic_algo.setDuplicateElimination(true);
 	_nqueen_genetic_algo.run();
 	_nqueen_genetic_algo.displaySettings();
 	_nqueen_genetic_algo.displayResults();
@@ -0,0 +1,92 @@
+/*
+ * nqueen_distributed_demo.cpp
+ * A Genetic Algorithm demo for solving N-QUEEN problem with fitness
+ * calculated by local worker processes over TCP
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#include <cstdlib>
+#include <signal.h>
+#include <sys/wait.h>
+#include "nqueen_ga.h"
+#include "eval/tcp_evaluator.h"
+#include "eval/tcp_worker.h"
+
+using namespace std;
+
+/**
+ * DISTRIBUTED N-QUEEN DEMO
+ * ========================
+ * usage : nqueen_distributed_demo [number of workers]
+ *
+ * Starts worker processes on localhost (default 4) and solves N-QUEEN problem
+ * with N = 100, while fitness of each generation is calculated by the workers.
+ * One worker is killed during the run to show that its batches are retried.
+ * Workers on other machines can be started with "nqueen_worker".
+ *
+ */
+
+int main(int argc, char * argv[])
+{
+	const int N = 100;
+	const int num_of_workers = argc > 1 ? max(1, atoi(argv[1])) : 4;
+
+	vector<tcp_endpoint> endpoints;
+	vector<pid_t> worker_pids;
+	for(int w = 0; w < num_of_workers; w++)
+	{
+		uint16_t port;
+		int listen_fd = tcpListen(0, port);
+		if(listen_fd < 0)
+		{
+			cerr<<"error cannot open a listening socket"<<endl;
+			return 1;
+		}
+
+		pid_t pid = fork();
+		if(pid == 0)
+		{
+			nqueen_fitness _nqueen_fitness(N);
+			runTcpWorker<vector<int>>(listen_fd,
+				[&_nqueen_fitness](const vector<int> & indiv) { return _nqueen_fitness(indiv); }, 1);
+			_exit(0);
+		}
+
+		close(listen_fd);
+		worker_pids.push_back(pid);
+		endpoints.push_back(tcp_endpoint {"127.0.0.1", port});
+	}
+
+	// connections are closed at the end of this block, so that workers exit
+	{
+		tcp_evaluator<vector<int>> _tcp_evaluator(endpoints);
+		_tcp_evaluator.setBatchSize(10);
+		_tcp_evaluator.setPipelineDepth(2);
+
+		// kill last worker, its connection breaks on first generation
+		if(num_of_workers > 1)
+		{
+			kill(worker_pids.back(), SIGKILL);
+		}
+
+		nqueen_genetic_algo _nqueen_genetic_algo(N);
+		_nqueen_genetic_algo.setParameters(100, -1, 0.9, 0.1, 0.03, true);
+		_nqueen_genetic_algo.setFitnessEvaluator(&_tcp_evaluator);
+		_nqueen_genetic_algo.run();
+		_nqueen_genetic_algo.displaySettings();
+		_nqueen_genetic_algo.displayResults();
+
+		cout<<"live workers - "<<_tcp_evaluator.getNumOfLiveWorkers()<<endl;
+		cout<<"retried batches - "<<_tcp_evaluator.getNumOfRetries()<<endl;
+	}
+
+	for(pid_t pid : worker_pids)
+	{
+		waitpid(pid, NULL, 0);
+	}
+
+	return 0;
+}
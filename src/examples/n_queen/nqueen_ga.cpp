@@ -6,6 +6,8 @@
  *      Author: S.Khan
  */
 
+#include <climits>
+#include <cstdlib>
 #include "nqueen_ga.h"
 
 using namespace std;
@@ -23,59 +25,132 @@ using namespace ga;
  * MUTATION OPERATOR - Swap Mutation (randomly selected allele is swapped with
  * an allele at one of the conflicting position of the individual)
  *
+ * LOCAL SEARCH - Min-Conflicts with swap moves (for memetic mode, see setLocalSearch)
+ *
  * STOPPING CRITERION - a solution is found with no conflict
  *
  */
 
 /**
- * generate random integers between 0 to (N_QUEEN_NUM - 1)
- * for N positions and make sure each integer occurs only once.
+ * generate a random permutation of integers from 0 to (N_QUEEN_NUM - 1)
+ * (Fisher-Yates shuffle, so each integer occurs only once)
  */
 vector<int> nqueen_genetic_algo::getRandomIndiv()
 {
-	vector<int> indiv;
-	int position;
-	map<int, bool> taken_map;
-	for(int i = 0; i < N_QUEEN_NUM; i++)
+	return randomPermutation(N_QUEEN_NUM, random_engine_init);
+}
+
+/**
+ * generate a random permutation using only the given random engine,
+ * so that initial population can be generated with several threads
+ */
+bool nqueen_genetic_algo::generateRandomIndiv(vector<int> & indiv,
+		random_engine_type & random_engine)
+{
+	fillRandomPermutation(indiv, N_QUEEN_NUM, random_engine);
+	return true;
+}
+
+/**
+ * each random engine is an independent stream of GA's seed
+ */
+void nqueen_genetic_algo::initRandomEngines()
+{
+	random_engine_init = nextRandomStream();
+	random_engine_shuffle = nextRandomStream();
+	random_engine_allele_mutation = nextRandomStream();
+	random_engine_conflict_selection = nextRandomStream();
+	random_engine_crossover_pt1 = nextRandomStream();
+	random_engine_local_search = nextRandomStream();
+}
+
+/**
+ * add negative values for horizontal and cross conflicts
+ * for each of the allele uniquely (queens are counted on each line of the board,
+ * so it is O(N) instead of checking all pairs)
+ */
+double nqueen_genetic_algo::getFitness(const vector<int> & indiv)
+{
+	// line counts of this thread (evaluation threads also call getFitness),
+	// which are all zero again after counting
+	static thread_local vector<int32_t> line_counts;
+	line_counts.resize(max(line_counts.size(), nqueenLineCountsSize(N_QUEEN_NUM, 1)), 0);
+	return - countNqueenIndivConflicts(indiv.data(), N_QUEEN_NUM, line_counts.data());
+}
+
+/**
+ * fitness of individuals with batched conflict kernel (NQUEEN_BATCH_WIDTH at once),
+ * values are the same as getFitness. It is not used for N > NQUEEN_BATCH_MAX_N,
+ * where getFitness of one individual at a time is faster.
+ */
+bool nqueen_genetic_algo::getBatchFitness(const vector<int> * const * indivs,
+		double * fitness, size_t num_of_indivs)
+{
+	if(N_QUEEN_NUM > NQUEEN_BATCH_MAX_N)
+	{
+		return false;
+	}
+
+	arena_vector<int32_t> rows(N_QUEEN_NUM*NQUEEN_BATCH_WIDTH, 0,
+			arena_allocator<int32_t>(scratch_arena));
+	arena_vector<int32_t> line_counts(nqueenLineCountsSize(N_QUEEN_NUM), 0,
+			arena_allocator<int32_t>(scratch_arena));
+	int32_t conflicts[NQUEEN_BATCH_WIDTH];
+	for(size_t first = 0; first < num_of_indivs; first += NQUEEN_BATCH_WIDTH)
 	{
-		do
+		const size_t batch_size = min(NQUEEN_BATCH_WIDTH, num_of_indivs - first);
+		loadNqueenBatch(indivs + first, batch_size, N_QUEEN_NUM, rows.data());
+		countNqueenConflicts(rows.data(), N_QUEEN_NUM, conflicts, NULL, line_counts.data(),
+				kernel_isa);
+		for(size_t lane = 0; lane < batch_size; lane++)
 		{
-			position = (int) (rand()%N_QUEEN_NUM);
+			fitness[first + lane] = - conflicts[lane];
 		}
-		while(taken_map[position]);
-		indiv.push_back(position);
-		taken_map[position] = true;
 	}
-	return indiv;
+	return true;
 }
 
 /**
- * add negative values for horizontal and cross conflicts
- * for each of the allele uniquely
+ * conflicts of offspring from conflicts of its base parent : only pairs of queens
+ * with a changed column are checked again, in O(changes*N) instead of O(N*N)
  */
-double nqueen_genetic_algo::getFitness(const vector<int> & indiv)
+bool nqueen_genetic_algo::getFitnessDelta(const vector<int> & parent, double parent_fitness,
+		const vector<int> & offspring, const genome_change & change, double & fitness)
 {
-	double fitness = 0;
-	const int MAX_VALUE = N_QUEEN_NUM - 1;
-	for(int i = 0; i < N_QUEEN_NUM; i++)
+	// changed columns (each once, and only if their row is different)
+	arena_vector<char> is_changed(N_QUEEN_NUM, false, arena_allocator<char>(scratch_arena));
+	arena_vector<int> changed_columns((arena_allocator<int>(scratch_arena)));
+	for(size_t column : change.positions)
 	{
-		for(int j = i - 1; j >= 0; j--)
+		if(!is_changed[column] && offspring[column] != parent[column])
 		{
-			int distance_x = i - j;
-			// check for horizontal conflict
-			if((indiv[j] == indiv[i]) ||
-					// check for cross conflict from top
-					// and make sure it does not lie outside the board
-					(indiv[j] == indiv[i] - distance_x && indiv[j] >= 0) ||
-					// check for cross conflict from below
-					// and make sure it does not lie outside the board
-					(indiv[j] == indiv[i] + distance_x && indiv[j] <= MAX_VALUE))
+			is_changed[column] = true;
+			changed_columns.push_back(column);
+		}
+	}
+
+	auto isConflict = [](const vector<int> & indiv, int column1, int column2)
+	{
+		const int distance = abs(indiv[column1] - indiv[column2]);
+		return distance == 0 || distance == abs(column1 - column2);
+	};
+
+	int conflict_change = 0;
+	for(int column : changed_columns)
+	{
+		for(int other_column = 0; other_column < N_QUEEN_NUM; other_column++)
+		{
+			// a pair of two changed columns is checked once
+			if(other_column == column || (is_changed[other_column] && other_column < column))
 			{
-				fitness -= 1;
+				continue;
 			}
+			conflict_change += isConflict(offspring, column, other_column)
+					- isConflict(parent, column, other_column);
 		}
 	}
-	return fitness;
+	fitness = parent_fitness - conflict_change;
+	return true;
 }
 
 /**
@@ -83,7 +158,31 @@ double nqueen_genetic_algo::getFitness(const vector<int> & indiv)
  */
 vector<int> nqueen_genetic_algo::crossOver(const crossoverParents & crossover_parents)
 {
-	return onePointOrderCrossover(crossover_parents);
+	vector<int> offspring;
+	onePointOrderCrossover(crossover_parents, offspring, random_engine_shuffle,
+			random_engine_crossover_pt1, scratch_arena);
+	return offspring;
+}
+
+/**
+ * do one point order crossover in given offspring (reusing its memory)
+ */
+void nqueen_genetic_algo::crossOverInPlace(const crossoverParents & crossover_parents,
+		vector<int> & offspring)
+{
+	onePointOrderCrossover(crossover_parents, offspring, random_engine_shuffle,
+			random_engine_crossover_pt1, scratch_arena);
+}
+
+/**
+ * do one point order crossover with only the given engine (thread safe)
+ */
+bool nqueen_genetic_algo::crossOverWithEngine(const crossoverParents & crossover_parents,
+		vector<int> & offspring, random_engine_type & random_engine)
+{
+	onePointOrderCrossover(crossover_parents, offspring, random_engine, random_engine,
+			threadScratchArena());
+	return true;
 }
 
 /**
@@ -137,26 +236,35 @@ vector<int> nqueen_genetic_algo::crossOver(const crossoverParents & crossover_pa
  * offspring: a b c d i g j e f h
  *
  */
-vector<int> nqueen_genetic_algo::onePointOrderCrossover(const crossoverParents & crossoverParents)
+void nqueen_genetic_algo::onePointOrderCrossover(const crossoverParents & crossoverParents,
+		vector<int> & indiv, random_engine_type & shuffle_random_engine,
+		random_engine_type & crossover_pt_random_engine, generation_arena & arena)
 {
+	// distributions are copied, so that several threads can do crossover at once
+	uniform_real_distribution<float> uniform_float_distribution = _uniform_float_distribution;
+	uniform_int_distribution<int> uniform_distribution_crossover_pt =
+		_uniform_distribution_crossover_pt;
+
 	// first shuffle parent1 and parent2 to remove any bias
 	// (specially for individuals with large number of allele)
-	vector<int> parent1, parent2;
-	if(_uniform_float_distribution(random_engine_shuffle) < 0.5f)
+	const vector<int> * parent1P = crossoverParents.parent1;
+	const vector<int> * parent2P = crossoverParents.parent2;
+	if(!(uniform_float_distribution(shuffle_random_engine) < 0.5f))
 	{
-		parent1 = (vector<int>) *crossoverParents.parent1;
-		parent2 = (vector<int>) *crossoverParents.parent2;
-	}
-	else
-	{
-		parent1 = (vector<int>) *crossoverParents.parent2;
-		parent2 = (vector<int>) *crossoverParents.parent1;
+		swap(parent1P, parent2P);
 	}
+	const vector<int> & parent1 = *parent1P;
+	const vector<int> & parent2 = *parent2P;
+
+	int crossover_point1 = uniform_distribution_crossover_pt(crossover_pt_random_engine);
 
-	int crossover_point1 = _uniform_distribution_crossover_pt(random_engine_crossover_pt1);
+	// temporary values are taken from given scratch arena (no heap allocation)
+	arena_allocator<int> scratch_allocator(arena);
 
-	vector<int> indiv(N_QUEEN_NUM);
-	map<int, bool> assigned_map;
+	// every position of offspring is assigned below
+	indiv.resize(N_QUEEN_NUM);
+	// assigned_map[value] is true if value is already in offspring
+	arena_vector<char> assigned_map(N_QUEEN_NUM, false, scratch_allocator);
 	int ith_value;
 	for(int i = 0; i < crossover_point1; i++)
 	{
@@ -166,7 +274,8 @@ vector<int> nqueen_genetic_algo::onePointOrderCrossover(const crossoverParents &
 	}
 
 	// copy from parent2 with no repetition
-	vector<int> unassigned_positions;
+	arena_vector<int> unassigned_positions(scratch_allocator);
+	unassigned_positions.reserve(N_QUEEN_NUM - crossover_point1);
 	for(int i = crossover_point1; i < N_QUEEN_NUM; i++)
 	{
 		ith_value = parent2[i];
@@ -185,7 +294,8 @@ vector<int> nqueen_genetic_algo::onePointOrderCrossover(const crossoverParents &
 	}
 
 	// find out the unassigned values of parent2
-	vector<int> unassigned_values;
+	arena_vector<int> unassigned_values(scratch_allocator);
+	unassigned_values.reserve(unassigned_positions.size());
 	for(int value_parent2 : parent2)
 	{
 		if(!assigned_map[value_parent2])
@@ -202,18 +312,53 @@ vector<int> nqueen_genetic_algo::onePointOrderCrossover(const crossoverParents &
 				<<unassigned_values.size()<<" => "<<unassigned_positions.size();
 
 		// no crossover can be done further, so return parent1
-		return parent1;
+		indiv = parent1;
+		return;
 	}
 
 	// fill remaining values to unassigned positions
-	for(int unassigned_position : unassigned_positions)
+	// (taking unassigned values from beginning in parent2)
+	for(size_t k = 0; k < unassigned_positions.size(); k++)
 	{
-		// take unassigned values from beginning in parent2
-		indiv[unassigned_position] = unassigned_values.front();
-		unassigned_values.erase(unassigned_values.begin());
+		indiv[unassigned_positions[k]] = unassigned_values[k];
 	}
 
-	return indiv;
+	if(isRecordingChanges())
+	{
+		recordCrossoverChanges(parent1, parent2, indiv);
+	}
+}
+
+/**
+ * note changes of an offspring for delta evaluation, relative to the parent
+ * it differs less from. Offspring is fully evaluated if it differs in more than
+ * 1/32 of its positions, since batched (SIMD) full evaluation is then faster.
+ */
+void nqueen_genetic_algo::recordCrossoverChanges(const vector<int> & parent1,
+		const vector<int> & parent2, const vector<int> & offspring)
+{
+	int num_of_changes1 = 0;
+	int num_of_changes2 = 0;
+	for(int i = 0; i < N_QUEEN_NUM; i++)
+	{
+		num_of_changes1 += offspring[i] != parent1[i];
+		num_of_changes2 += offspring[i] != parent2[i];
+	}
+
+	const vector<int> & base_parent = num_of_changes1 <= num_of_changes2 ? parent1 : parent2;
+	recordChangeBase(base_parent);
+	if(32*min(num_of_changes1, num_of_changes2) > N_QUEEN_NUM)
+	{
+		recordIncompleteChange();
+		return;
+	}
+	for(int i = 0; i < N_QUEEN_NUM; i++)
+	{
+		if(offspring[i] != base_parent[i])
+		{
+			recordChange(i);
+		}
+	}
 }
 
 /**
@@ -230,10 +375,11 @@ void nqueen_genetic_algo::displayIndiv(const vector<int> & indiv)
 
 /**
  * stop when a solution is found with no conflict
+ * (or when maximum generations or stopping criterion of simple GA is reached)
  */
 bool nqueen_genetic_algo::shouldStop()
 {
-	return best_fitness >= 0;
+	return best_fitness >= 0 || simple_ga::shouldStop();
 }
 
 /**
@@ -241,23 +387,46 @@ bool nqueen_genetic_algo::shouldStop()
  */
 void nqueen_genetic_algo::mutate(vector<int> &indiv)
 {
-	vector<int> conflicting_positions = getConflictingPositions(indiv);
+	conflictSwapMutation(indiv, random_engine_allele_mutation,
+			random_engine_conflict_selection, scratch_arena);
+}
+
+/**
+ * mutation with only the given engine (thread safe)
+ */
+bool nqueen_genetic_algo::mutateWithEngine(vector<int> & indiv,
+		random_engine_type & random_engine)
+{
+	conflictSwapMutation(indiv, random_engine, random_engine, threadScratchArena());
+	return true;
+}
+
+void nqueen_genetic_algo::conflictSwapMutation(vector<int> & indiv,
+		random_engine_type & allele_random_engine, random_engine_type & conflict_random_engine,
+		generation_arena & arena)
+{
+	uniform_real_distribution<double> uniform_double_distribution = _uniform_double_distribution;
+	arena_vector<int> conflicting_positions((arena_allocator<int>(arena)));
+	getConflictingPositions(indiv, conflicting_positions, arena);
 	int total_conflicts;
 	for(int i = 0; i < N_QUEEN_NUM; i++)
 	{
-		if(_uniform_double_distribution(random_engine_allele_mutation)
+		if(uniform_double_distribution(allele_random_engine)
 				< ALLELE_MUTATION_PROBABILITY)
 		{
 			total_conflicts = conflicting_positions.size();
 			if(total_conflicts > 0)
 			{
-				int jth_random = rand()%total_conflicts;
+				uniform_int_distribution<int> distrib_conflict(0, total_conflicts - 1);
+				int jth_random = distrib_conflict(conflict_random_engine);
 				int conflict_position = conflicting_positions[jth_random];
 
 				// swap conflict position value with this value
 				int temp_value = indiv[i];
 				indiv[i] = indiv[conflict_position];
 				indiv[conflict_position] = temp_value;
+				recordChange(i);
+				recordChange(conflict_position);
 
 				// remove this conflicting position
 				conflicting_positions.erase(conflicting_positions.begin() + jth_random);
@@ -266,28 +435,141 @@ void nqueen_genetic_algo::mutate(vector<int> &indiv)
 	}
 }
 
-vector<int> nqueen_genetic_algo::getConflictingPositions(const vector<int> & indiv)
+/**
+ * MIN-CONFLICTS LOCAL SEARCH
+ * ==========================
+ * Since each row has one queen in a permutation, all conflicts are on diagonals,
+ * and number of conflicts is sum of (count*(count - 1)/2) over all diagonals.
+ * Queens on each diagonal and anti-diagonal are counted once, then in each step :
+ *
+ * STEP 1 - select a random column whose queen is in conflict
+ * (stop if there is none, a solution is found)
+ *
+ * STEP 2 - find change in conflicts for swapping its row with row of each other
+ * column (O(1) for each swap using diagonal counts)
+ *
+ * STEP 3 - do the best swap if it does not increase conflicts
+ * (sideways moves are allowed so that search can leave a plateau)
+ *
+ * Each step is one step of the budget. Conflicts are updated incrementally,
+ * so no full fitness calculation is done.
+ */
+double nqueen_genetic_algo::localSearch(vector<int> & indiv, double fitness, unsigned budget)
 {
-	vector<int> conflicting_positions;
-	int distance_x;
-	const int MAX_VALUE = N_QUEEN_NUM - 1;
-	for(int i = 0; i < N_QUEEN_NUM; i++)
+	const int num_of_diagonals = 2*N_QUEEN_NUM - 1;
+	arena_allocator<int> scratch_allocator(scratch_arena);
+	// diagonal of (row, column) is row + column,
+	// anti-diagonal is row - column + N_QUEEN_NUM - 1
+	arena_vector<int> diagonal_counts(num_of_diagonals, 0, scratch_allocator);
+	arena_vector<int> anti_diagonal_counts(num_of_diagonals, 0, scratch_allocator);
+	for(int column = 0; column < N_QUEEN_NUM; column++)
+	{
+		diagonal_counts[indiv[column] + column]++;
+		anti_diagonal_counts[indiv[column] - column + N_QUEEN_NUM - 1]++;
+	}
+
+	// given fitness is not used, since with Baldwinian write-back it is an improved
+	// fitness of an earlier search and not fitness of this individual
+	int conflicts = 0;
+	for(int d = 0; d < num_of_diagonals; d++)
+	{
+		conflicts += diagonal_counts[d]*(diagonal_counts[d] - 1)/2
+				+ anti_diagonal_counts[d]*(anti_diagonal_counts[d] - 1)/2;
+	}
+
+	uniform_int_distribution<int> column_distribution(0, N_QUEEN_NUM - 1);
+	for(unsigned step = 0; step < budget && conflicts > 0; step++)
 	{
-		for(int j = i - 1; j >= 0; j--)
+		// first conflicting column from a random column onwards
+		const int start_column = column_distribution(random_engine_local_search);
+		int conflicting_column = -1;
+		for(int k = 0; k < N_QUEEN_NUM && conflicting_column < 0; k++)
+		{
+			const int column = (start_column + k) % N_QUEEN_NUM;
+			if(diagonal_counts[indiv[column] + column] > 1
+					|| anti_diagonal_counts[indiv[column] - column + N_QUEEN_NUM - 1] > 1)
+			{
+				conflicting_column = column;
+			}
+		}
+
+		// best swap partner (first of equally good ones from a random column)
+		const int start_partner = column_distribution(random_engine_local_search);
+		int best_partner = -1;
+		int best_delta = INT_MAX;
+		for(int k = 0; k < N_QUEEN_NUM; k++)
 		{
-			distance_x = i - j;
-			// check for horizontal conflict
-			if((indiv[j] == indiv[i]) ||
-					// check for cross conflict from top
-					// and make sure it does not lie outside the board
-					(indiv[j] == indiv[i] - distance_x && indiv[j] >= 0) ||
-					// check for cross conflict from below
-					// and make sure it does not lie outside the board
-					(indiv[j] == indiv[i] + distance_x && indiv[j] <= MAX_VALUE))
+			const int partner = (start_partner + k) % N_QUEEN_NUM;
+			if(partner != conflicting_column)
 			{
-				conflicting_positions.push_back(i);
+				// swap, note change in conflicts and swap back
+				const int delta = swapConflictsDelta(indiv, conflicting_column, partner,
+						diagonal_counts, anti_diagonal_counts);
+				swapConflictsDelta(indiv, conflicting_column, partner,
+						diagonal_counts, anti_diagonal_counts);
+				if(delta < best_delta)
+				{
+					best_delta = delta;
+					best_partner = partner;
+				}
 			}
 		}
+
+		if(best_delta <= 0)
+		{
+			swapConflictsDelta(indiv, conflicting_column, best_partner,
+					diagonal_counts, anti_diagonal_counts);
+			conflicts += best_delta;
+		}
+	}
+
+	// fitness of a permutation is negative of number of conflicts
+	return -conflicts;
+}
+
+/**
+ * swap rows of two columns (updating diagonal counts) and
+ * return change in number of conflicts
+ */
+int nqueen_genetic_algo::swapConflictsDelta(vector<int> & indiv, int column1, int column2,
+		arena_vector<int> & diagonal_counts, arena_vector<int> & anti_diagonal_counts)
+{
+	const int offset = N_QUEEN_NUM - 1;
+	int delta = 0;
+	// remove both queens (each removed queen was in conflict with others on its diagonals)
+	for(int column : {column1, column2})
+	{
+		delta -= --diagonal_counts[indiv[column] + column];
+		delta -= --anti_diagonal_counts[indiv[column] - column + offset];
+	}
+	swap(indiv[column1], indiv[column2]);
+	// add both queens at swapped rows
+	for(int column : {column1, column2})
+	{
+		delta += diagonal_counts[indiv[column] + column]++;
+		delta += anti_diagonal_counts[indiv[column] - column + offset]++;
+	}
+	return delta;
+}
+
+/**
+ * later position of each conflicting pair of queens (so a position is listed once
+ * for each conflict with a queen of an earlier column), from conflicts of each
+ * position with earlier columns counted on lines of the board in O(N)
+ */
+void nqueen_genetic_algo::getConflictingPositions(const vector<int> & indiv,
+		arena_vector<int> & conflicting_positions, generation_arena & arena)
+{
+	arena_vector<int32_t> earlier_conflicts(N_QUEEN_NUM, 0, arena_allocator<int32_t>(arena));
+	arena_vector<int32_t> line_counts(nqueenLineCountsSize(N_QUEEN_NUM, 1), 0,
+			arena_allocator<int32_t>(arena));
+	countNqueenIndivConflicts(indiv.data(), N_QUEEN_NUM, line_counts.data(), NULL,
+			earlier_conflicts.data());
+
+	conflicting_positions.clear();
+	conflicting_positions.reserve(N_QUEEN_NUM);
+	for(int i = 0; i < N_QUEEN_NUM; i++)
+	{
+		conflicting_positions.insert(conflicting_positions.end(), earlier_conflicts[i], i);
 	}
-	return conflicting_positions;
 }
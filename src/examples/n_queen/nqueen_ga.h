@@ -10,6 +10,8 @@
 #define NQUEEN_GA_H_
 
 # include "ga.h"
+# include "util/permutations.h"
+# include "nqueen_conflict_kernel.h"
 
 using namespace std;
 using namespace ga;
@@ -41,11 +43,13 @@ using namespace ga;
  *
  */
 
-class nqueen_genetic_algo : public simple_ga<vector<int>>
+class nqueen_genetic_algo : public simple_ga<vector<int>, xoshiro256ss>
 {
 public :
 	explicit nqueen_genetic_algo(int n_queen_number)
 	{
+		initRandomEngines();
+
 		if(n_queen_number < 4) // show error message and set to default
 		{
 			cerr<<"error invalid value of N : "<<n_queen_number<<
@@ -63,10 +67,23 @@ public :
 
 protected:
 	vector<int> getRandomIndiv() override;
+	bool generateRandomIndiv(vector<int> & indiv, random_engine_type & random_engine) override;
+	void initRandomEngines() override;
 	double getFitness(const vector<int> & indiv) override;
+	bool getBatchFitness(const vector<int> * const * indivs, double * fitness,
+			size_t num_of_indivs) override;
+	bool getFitnessDelta(const vector<int> & parent, double parent_fitness,
+			const vector<int> & offspring, const genome_change & change,
+			double & fitness) override;
 	void displayIndiv(const vector<int> & indiv) override;
 	vector<int> crossOver(const crossoverParents & crossover_parents) override;
+	void crossOverInPlace(const crossoverParents & crossover_parents,
+			vector<int> & offspring) override;
+	bool crossOverWithEngine(const crossoverParents & crossover_parents,
+			vector<int> & offspring, random_engine_type & random_engine) override;
 	void mutate(vector<int> &indiv) override;
+	bool mutateWithEngine(vector<int> & indiv, random_engine_type & random_engine) override;
+	double localSearch(vector<int> & indiv, double fitness, unsigned budget) override;
 	bool shouldStop() override;
 
 private:
@@ -76,12 +93,21 @@ private:
 	 */
 	int N_QUEEN_NUM = 100;
 
+	// random individual generation engine
+	random_engine_type random_engine_init;
 	// shuffle random engine
-	mt19937 random_engine_shuffle;
+	random_engine_type random_engine_shuffle;
 	// allele mutation random engine
-	mt19937 random_engine_allele_mutation;
+	random_engine_type random_engine_allele_mutation;
+	// conflicting position selection random engine
+	random_engine_type random_engine_conflict_selection;
 	// crossover point 1 random engine
-	mt19937 random_engine_crossover_pt1 {1};
+	random_engine_type random_engine_crossover_pt1;
+	// min-conflicts local search random engine
+	random_engine_type random_engine_local_search;
+
+	// instruction set of batched conflict kernel (best one of this CPU)
+	const nqueen_kernel_isa kernel_isa = detectNqueenKernelIsa();
 
 	// generate uniformly distribution values
 	// for float value between 0 and 1
@@ -91,8 +117,35 @@ private:
 	// for integer value between 1 and NQUEEN_NUM - 1
 	uniform_int_distribution<int> _uniform_distribution_crossover_pt {1, N_QUEEN_NUM - 1};
 
-	vector<int> getConflictingPositions(const vector<int> & indiv);
-	vector<int> onePointOrderCrossover(const crossoverParents & crossoverParents);
+	void getConflictingPositions(const vector<int> & indiv,
+			arena_vector<int> & conflicting_positions, generation_arena & arena);
+	int swapConflictsDelta(vector<int> & indiv, int column1, int column2,
+			arena_vector<int> & diagonal_counts, arena_vector<int> & anti_diagonal_counts);
+	void onePointOrderCrossover(const crossoverParents & crossoverParents,
+			vector<int> & offspring, random_engine_type & shuffle_random_engine,
+			random_engine_type & crossover_pt_random_engine, generation_arena & arena);
+	void recordCrossoverChanges(const vector<int> & parent1, const vector<int> & parent2,
+			const vector<int> & offspring);
+	void conflictSwapMutation(vector<int> & indiv, random_engine_type & allele_random_engine,
+			random_engine_type & conflict_random_engine, generation_arena & arena);
+};
+
+/**
+ * N-QUEEN FITNESS (nqueen_fitness)
+ * ================================
+ * Gives access to fitness function of nqueen_genetic_algo
+ * (e.g. for calculating fitness in a worker process).
+ *
+ */
+class nqueen_fitness : public nqueen_genetic_algo
+{
+public :
+	explicit nqueen_fitness(int n_queen_number) : nqueen_genetic_algo(n_queen_number) { }
+
+	double operator()(const vector<int> & indiv)
+	{
+		return getFitness(indiv);
+	}
 };
 
 #endif /* NQUEEN_GA_H_ */
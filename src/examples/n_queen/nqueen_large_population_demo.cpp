@@ -0,0 +1,40 @@
+/*
+ * nqueen_large_population_demo.cpp
+ * A large population Genetic Algorithm demo for solving N-QUEEN problem
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#include <cstdlib>
+#include "nqueen_ga.h"
+
+using namespace std;
+
+/**
+ * N-QUEEN LARGE POPULATION DEMO
+ * =============================
+ * A demo run for solving N-QUEEN problem with N = 32 and a population of
+ * 100000 individuals (or the size given as first argument), evolved in large
+ * population mode with a chunk for each hardware thread (or the number of chunks
+ * given as second argument). Best 1% of each chunk migrates to the next chunk
+ * every 10 generations.
+ *
+ */
+
+int main(int argc, char * argv[])
+{
+	const long long population_size = argc > 1 ? atoll(argv[1]) : 100000;
+	const unsigned num_of_chunks = argc > 2 ?
+			atoi(argv[2]) : max(1u, thread::hardware_concurrency());
+
+	nqueen_genetic_algo _nqueen_genetic_algo(32);
+	_nqueen_genetic_algo.setParameters(population_size, 100, 0.9, 0.1, 0.03, true);
+	_nqueen_genetic_algo.setLargePopulationMode(num_of_chunks, 10, 0.01);
+	_nqueen_genetic_algo.run();
+	_nqueen_genetic_algo.displaySettings();
+	_nqueen_genetic_algo.displayResults();
+
+	return 0;
+}
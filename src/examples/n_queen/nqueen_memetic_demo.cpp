@@ -0,0 +1,34 @@
+/*
+ * nqueen_memetic_demo.cpp
+ * A memetic Genetic Algorithm demo for solving N-QUEEN problem
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#include "nqueen_ga.h"
+
+using namespace std;
+
+/**
+ * N-QUEEN MEMETIC DEMO
+ * ====================
+ * A demo run for solving N-QUEEN problem with N = 1000, where 5 best individuals
+ * of each generation are improved by min-conflicts local search (at most
+ * 50 steps each) and kept in population (Lamarckian write-back).
+ *
+ */
+
+int main()
+{
+	nqueen_genetic_algo _nqueen_genetic_algo(1000);
+	_nqueen_genetic_algo.setParameters(100, -1, 0.9, 0.1, 0.03, true);
+	_nqueen_genetic_algo.setInitializationThreads(max(1u, thread::hardware_concurrency()));
+	_nqueen_genetic_algo.setLocalSearch(5, 50, true);
+	_nqueen_genetic_algo.run();
+	_nqueen_genetic_algo.displaySettings();
+	_nqueen_genetic_algo.displayResults();
+
+	return 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * nqueen_tuning_demo.cpp
+ * A demo of tuning parameters of N-QUEEN Genetic Algorithm by racing them
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#include <fstream>
+#include "nqueen_ga.h"
+#include "parameter_tuner.h"
+
+using namespace std;
+
+/**
+ * N-QUEEN TUNING DEMO
+ * ===================
+ * Races 16 random parameter sets and the parameters of nqueen_demo for N = 30,
+ * to find the one that solves it (target fitness 0) with fewest evaluations.
+ * Each candidate is run with 5 seeds, first with a budget of 2000 evaluations,
+ * and half of the candidates survive each round (budget is doubled).
+ *
+ * Results of all rounds are displayed as CSV, and best parameters are written as
+ * JSON to "nqueen_tuned_parameters.json".
+ *
+ */
+
+int main()
+{
+	const int N = 30;
+
+	parameter_tuner tuner(max(1u, thread::hardware_concurrency()), 0);
+	tuner.setSeeds(5);
+	tuner.setRace(2000, 64000, 2);
+
+	// parameters of nqueen_demo
+	ga_parameters demo_parameters;
+	demo_parameters.population_size = 100;
+	demo_parameters.crossover_prob = 0.9;
+	demo_parameters.mutation_prob = 0.1;
+	demo_parameters.allele_mutation_prob = 0.03;
+	tuner.addCandidate(demo_parameters);
+	tuner.addRandomCandidates(ga_parameter_space(), 16, 1);
+
+	const ga_parameters best_parameters = tuner.tune([N]()
+	{
+		return new nqueen_genetic_algo(N);
+	});
+
+	tuner.writeCsv(cout);
+	cout<<endl<<"best parameters : "<<best_parameters.toString()<<endl;
+
+	ofstream json_file("nqueen_tuned_parameters.json");
+	tuner.writeBestParameters(json_file);
+
+	return 0;
+}
@@ -0,0 +1,59 @@
+/*
+ * nqueen_worker.cpp
+ * A worker process that calculates N-QUEEN fitness for a GA over TCP
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#include <cstdlib>
+#include "nqueen_ga.h"
+#include "eval/tcp_worker.h"
+
+using namespace std;
+
+/**
+ * N-QUEEN WORKER
+ * ==============
+ * usage : nqueen_worker <port> [N]
+ *
+ * Listens on given port (0 selects any free port) and replies to
+ * requests of a GA master (tcp_evaluator) with fitness of N-Queen individuals.
+ * It keeps running until it is killed.
+ *
+ */
+
+int main(int argc, char * argv[])
+{
+	if(argc < 2)
+	{
+		cerr<<"usage : "<<argv[0]<<" <port> [N]"<<endl;
+		return 1;
+	}
+
+	const uint16_t port = (uint16_t) atoi(argv[1]);
+	const int n_queen_number = argc > 2 ? atoi(argv[2]) : 100;
+
+	uint16_t bound_port;
+	int listen_fd = tcpListen(port, bound_port);
+	if(listen_fd < 0)
+	{
+		cerr<<"error cannot listen on port "<<port<<endl;
+		return 1;
+	}
+	cout<<"nqueen worker (N = "<<n_queen_number<<") listening on port "<<bound_port<<endl;
+
+	// upto 65536 encoded individuals (size and N genes) are accepted in a request
+	const uint64_t MAX_INDIVS_PER_REQUEST = 1 << 16;
+	const uint64_t max_payload_size = MAX_INDIVS_PER_REQUEST*
+			(sizeof(uint64_t) + n_queen_number*sizeof(int));
+
+	nqueen_fitness _nqueen_fitness(n_queen_number);
+	runTcpWorker<vector<int>>(listen_fd,
+			[&_nqueen_fitness](const vector<int> & indiv) { return _nqueen_fitness(indiv); },
+			0, max_payload_size);
+
+	close(listen_fd);
+	return 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * telemetry_to_csv.cpp
+ * Reads a telemetry ring buffer file of a GA run and writes its records as CSV
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: S.Khan
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <sys/stat.h>
+#include "util/telemetry_ring.h"
+
+using namespace std;
+using namespace ga;
+
+/**
+ * TELEMETRY TO CSV
+ * ================
+ * telemetry_to_csv FILE [--follow] [--interval-ms N]
+ *
+ * Writes records in FILE (see setTelemetry of simple_ga) as CSV with a header line.
+ * With --follow it keeps reading new records every N ms (100 by default), like
+ * "tail -f", until the GA closes the file (waiting for the file if GA has not
+ * created it yet). It only maps the file for reading,
+ * so the GA is never blocked by it.
+ * Number of records that were overwritten before they could be read is
+ * displayed at the end (on standard error).
+ *
+ */
+
+void writeCsv(const vector<telemetry_record> & records)
+{
+	for(const telemetry_record & record : records)
+	{
+		cout<<record.generation<<","<<record.num_of_evaluations<<","<<record.elapsed_seconds
+				<<","<<record.best_fitness<<","<<record.gen_best_fitness
+				<<","<<record.avg_fitness<<","<<record.gen_min_fitness
+				<<","<<record.fitness_sum<<","<<record.fitness_variance<<"\n";
+	}
+	cout.flush();
+}
+
+int main(int argc, char * argv[])
+{
+	string path;
+	bool follow = false;
+	int interval_ms = 100;
+	for(int i = 1; i < argc; i++)
+	{
+		const string option = argv[i];
+		if(option == "--follow")
+		{
+			follow = true;
+		}
+		else if(option == "--interval-ms" && i + 1 < argc)
+		{
+			interval_ms = max(1, atoi(argv[++i]));
+		}
+		else if(path.empty() && option.compare(0, 2, "--") != 0)
+		{
+			path = option;
+		}
+		else
+		{
+			path.clear();
+			break;
+		}
+	}
+
+	if(path.empty())
+	{
+		cerr<<"usage : "<<argv[0]<<" FILE [--follow] [--interval-ms N]"<<endl;
+		return 2;
+	}
+
+	// wait until GA has created the file (with its header)
+	struct stat file_stat;
+	while(follow && (stat(path.c_str(), &file_stat) != 0
+			|| (size_t) file_stat.st_size < telemetry_layout::HEADER_SIZE))
+	{
+		this_thread::sleep_for(chrono::milliseconds(interval_ms));
+	}
+
+	telemetry_reader reader(path);
+	while(follow && !reader.isReady())
+	{
+		this_thread::sleep_for(chrono::milliseconds(interval_ms));
+	}
+
+	cout.precision(12);
+	cout<<"generation,evaluations,elapsed_seconds,best_fitness,gen_best_fitness,"
+			<<"avg_fitness,gen_min_fitness,fitness_sum,fitness_variance"<<endl;
+
+	vector<telemetry_record> records;
+	while(true)
+	{
+		// closed is checked before reading, so that last records are not missed
+		const bool is_closed = reader.isClosed();
+		records.clear();
+		reader.read(records);
+		writeCsv(records);
+
+		if(!follow || is_closed)
+		{
+			break;
+		}
+		this_thread::sleep_for(chrono::milliseconds(interval_ms));
+	}
+
+	if(!reader.isReady())
+	{
+		cerr<<"error telemetry file is not ready : "<<path<<endl;
+		return 1;
+	}
+	if(reader.getNumOfLostRecords() > 0)
+	{
+		cerr<<"records overwritten before reading : "<<reader.getNumOfLostRecords()<<endl;
+	}
+	return 0;
+}